@@ -230,6 +230,11 @@ namespace graphene { namespace app {
        return {};
     }
 
+    std::map<string, api_executor_stats> network_node_api::get_api_executor_stats() const
+    {
+       return _app.get_api_executor_stats();
+    }
+
     fc::variant_object network_node_api::get_advanced_node_parameters() const
     {
        FC_ASSERT( _app.p2p_node() != nullptr, "No P2P network!" );
@@ -282,7 +287,8 @@ namespace graphene { namespace app {
        if( !_database_api )
        {
           _database_api = std::make_shared< database_api >( std::ref( *_app.chain_database() ),
-                                                            &( _app.get_options() ) );
+                                                            &( _app.get_options() ),
+                                                            _app.get_api_executor( "database_api" ) );
        }
        return *_database_api;
     }
@@ -369,7 +375,8 @@ namespace graphene { namespace app {
     }
 
     history_api::history_api(application& app)
-    : _app(app)
+    : _app(app),
+      _executor( app.get_api_executor( "history_api" ) )
     { // Nothing else to do
     }
 
@@ -377,6 +384,8 @@ namespace graphene { namespace app {
                                                                       const std::string& asset_b,
                                                                       uint32_t limit )const
     {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() { return get_fill_order_history( asset_a, asset_b, limit ); } );
        auto market_hist_plugin = _app.get_plugin<market_history_plugin>( "market_history" );
        FC_ASSERT( market_hist_plugin, "Market history plugin is not enabled" );
        FC_ASSERT(_app.chain_database());
@@ -408,6 +417,8 @@ namespace graphene { namespace app {
                                                                        uint32_t limit,
                                                                        operation_history_id_type start ) const
     {
+       if( _executor && !api_executor::in_worker_thread() && !_app.is_plugin_enabled("elasticsearch") )
+          return _executor->run( [&]() { return get_account_history( account_id_or_name, stop, limit, start ); } );
        FC_ASSERT( _app.chain_database(), "database unavailable" );
        const auto& db = *_app.chain_database();
 
@@ -466,6 +477,10 @@ namespace graphene { namespace app {
             const optional<uint32_t>& olimit,
             const optional<fc::time_point_sec>& ostart ) const
     {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() {
+             return get_account_history_by_time( account_name_or_id, olimit, ostart );
+          } );
        FC_ASSERT( _app.chain_database(), "database unavailable" );
        const auto& db = *_app.chain_database();
 
@@ -509,6 +524,10 @@ namespace graphene { namespace app {
           operation_history_id_type stop,
           uint32_t limit ) const
     {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() {
+             return get_account_history_operations( account_id_or_name, operation_type, start, stop, limit );
+          } );
        FC_ASSERT( _app.chain_database(), "database unavailable" );
        const auto& db = *_app.chain_database();
 
@@ -554,6 +573,10 @@ namespace graphene { namespace app {
                                                                                 uint32_t limit,
                                                                                 uint64_t start ) const
     {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() {
+             return get_relative_account_history( account_id_or_name, stop, limit, start );
+          } );
        FC_ASSERT( _app.chain_database(), "database unavailable" );
        const auto& db = *_app.chain_database();
 
@@ -596,6 +619,8 @@ namespace graphene { namespace app {
           uint32_t block_num,
           const optional<uint16_t>& trx_in_block ) const
     {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() { return get_block_operation_history( block_num, trx_in_block ); } );
        FC_ASSERT( _app.chain_database(), "database unavailable" );
        const auto& db = *_app.chain_database();
        const auto& idx = db.get_index_type<operation_history_index>().indices().get<by_block>();
@@ -609,6 +634,8 @@ namespace graphene { namespace app {
     vector<operation_history_object> history_api::get_block_operations_by_time(
           const optional<fc::time_point_sec>& start ) const
     {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() { return get_block_operations_by_time( start ); } );
        FC_ASSERT( _app.chain_database(), "database unavailable" );
        const auto& db = *_app.chain_database();
        const auto& idx = db.get_index_type<operation_history_index>().indices().get<by_time>();
@@ -637,6 +664,10 @@ namespace graphene { namespace app {
           const flat_set<uint16_t>& operation_types,
           uint32_t start, uint32_t limit )const
     {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() {
+             return get_account_history_by_operations( account_id_or_name, operation_types, start, limit );
+          } );
        const auto configured_limit = _app.get_options().api_limit_get_account_history_by_operations;
        FC_ASSERT( limit <= configured_limit,
                   "limit can not be greater than ${configured_limit}",
@@ -667,6 +698,10 @@ namespace graphene { namespace app {
                                                            const fc::time_point_sec& start,
                                                            const fc::time_point_sec& end )const
     { try {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() {
+             return get_market_history( asset_a, asset_b, bucket_seconds, start, end );
+          } );
 
        auto market_hist_plugin = _app.get_plugin<market_history_plugin>( "market_history" );
        FC_ASSERT( market_hist_plugin, "Market history plugin is not enabled" );
@@ -720,6 +755,10 @@ namespace graphene { namespace app {
                const optional<uint32_t>& olimit,
                const optional<int64_t>& operation_type )const
     { try {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() {
+             return get_liquidity_pool_history( pool_id, start, stop, olimit, operation_type );
+          } );
        uint32_t limit = validate_get_lp_history_params( _app, olimit );
 
        vector<liquidity_pool_history_object> result;
@@ -769,6 +808,10 @@ namespace graphene { namespace app {
                const optional<uint32_t>& olimit,
                const optional<int64_t>& operation_type )const
     { try {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() {
+             return get_liquidity_pool_history_by_sequence( pool_id, start, stop, olimit, operation_type );
+          } );
        uint32_t limit = validate_get_lp_history_params( _app, olimit );
 
        vector<liquidity_pool_history_object> result;
@@ -886,13 +929,16 @@ namespace graphene { namespace app {
     // asset_api
     asset_api::asset_api(graphene::app::application& app)
     : _app(app),
-      _db( *app.chain_database() )
+      _db( *app.chain_database() ),
+      _executor( app.get_api_executor( "asset_api" ) )
     { // Nothing else to do
     }
 
     vector<asset_api::account_asset_balance> asset_api::get_asset_holders( const std::string& asset_symbol_or_id,
                                                                            uint32_t start, uint32_t limit ) const
     {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() { return get_asset_holders( asset_symbol_or_id, start, limit ); } );
        const auto configured_limit = _app.get_options().api_limit_get_asset_holders;
        FC_ASSERT( limit <= configured_limit,
                   "limit can not be greater than ${configured_limit}",
@@ -931,6 +977,8 @@ namespace graphene { namespace app {
     }
     // get number of asset holders.
     int64_t asset_api::get_asset_holders_count( const std::string& asset_symbol_or_id ) const {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() { return get_asset_holders_count( asset_symbol_or_id ); } );
        const auto& bal_idx = _db.get_index_type< account_balance_index >().indices().get< by_asset_balance >();
        database_api_helper db_api_helper( _app );
        asset_id_type asset_id = db_api_helper.get_asset_from_string( asset_symbol_or_id )->get_id();
@@ -942,6 +990,8 @@ namespace graphene { namespace app {
     }
     // function to get vector of system assets with holders count.
     vector<asset_api::asset_holders> asset_api::get_all_asset_holders() const {
+       if( _executor && !api_executor::in_worker_thread() )
+          return _executor->run( [&]() { return get_all_asset_holders(); } );
        vector<asset_holders> result;
        vector<asset_id_type> total_assets;
        for( const asset_object& asset_obj : _db.get_index_type<asset_index>().indices() )
@@ -968,7 +1018,8 @@ namespace graphene { namespace app {
 
    // orders_api
    orders_api::orders_api(application& app)
-   : _app(app)
+   : _app(app),
+     _executor( app.get_api_executor( "orders_api" ) )
    { // Nothing else to do
    }
 
@@ -985,6 +1036,10 @@ namespace graphene { namespace app {
                                                                                  const optional<price>& start,
                                                                                  uint32_t limit )const
    {
+      if( _executor && !api_executor::in_worker_thread() )
+         return _executor->run( [&]() {
+            return get_grouped_limit_orders( base_asset, quote_asset, group, start, limit );
+         } );
       const auto configured_limit = _app.get_options().api_limit_get_grouped_limit_orders;
       FC_ASSERT( limit <= configured_limit,
                  "limit can not be greater than ${configured_limit}",
@@ -992,22 +1047,28 @@ namespace graphene { namespace app {
 
       auto plugin = _app.get_plugin<graphene::grouped_orders::grouped_orders_plugin>( "grouped_orders" );
       FC_ASSERT( plugin );
-      const auto& limit_groups = plugin->limit_order_groups();
       vector< limit_order_group > result;
 
       database_api_helper db_api_helper( _app );
       asset_id_type base_asset_id = db_api_helper.get_asset_from_string( base_asset )->get_id();
       asset_id_type quote_asset_id = db_api_helper.get_asset_from_string( quote_asset )->get_id();
 
-      price max_price = price::max( base_asset_id, quote_asset_id );
-      price min_price = price::min( base_asset_id, quote_asset_id );
+      const auto depth = plugin->get_limit_order_group_depth( group, base_asset_id, quote_asset_id );
+      if( !depth )
+         return result;
+
+      auto itr = depth->begin();
       if( start.valid() && !start->is_null() )
+      {
+         price max_price = price::max( base_asset_id, quote_asset_id );
+         price min_price = price::min( base_asset_id, quote_asset_id );
          max_price = std::max( std::min( max_price, *start ), min_price );
-
-      auto itr = limit_groups.lower_bound( limit_order_group_key( group, max_price ) );
-      // use an end iterator to try to avoid expensive price comparison
-      auto end = limit_groups.upper_bound( limit_order_group_key( group, min_price ) );
-      while( itr != end && result.size() < limit )
+         itr = std::lower_bound( depth->begin(), depth->end(), limit_order_group_key( group, max_price ),
+                                 []( const std::pair<limit_order_group_key,limit_order_group_data>& g,
+                                     const limit_order_group_key& k ) { return g.first < k; } );
+      }
+      result.reserve( std::min<size_t>( limit, depth->end() - itr ) );
+      while( itr != depth->end() && result.size() < limit )
       {
          result.emplace_back( *itr );
          ++itr;
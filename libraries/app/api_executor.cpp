@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <graphene/app/api_executor.hpp>
+
+namespace graphene { namespace app {
+
+namespace {
+   thread_local bool is_api_worker_thread = false;
+}
+
+api_executor::api_executor( const std::string& api_name, const graphene::chain::database& db,
+                            uint16_t num_threads, uint32_t max_queued_calls )
+: _api_name( api_name ), _db( db ), _max_queued_calls( max_queued_calls )
+{
+   FC_ASSERT( num_threads > 0, "An API executor needs at least one thread" );
+   _workers.reserve( num_threads );
+   for( uint16_t i = 0; i < num_threads; ++i )
+   {
+      _workers.emplace_back( std::make_unique<worker>( _api_name + " " + std::to_string(i) ) );
+      _workers.back()->thread.async( [](){ is_api_worker_thread = true; } ).wait();
+   }
+}
+
+api_executor::~api_executor() = default;
+
+bool api_executor::in_worker_thread()
+{
+   return is_api_worker_thread;
+}
+
+api_executor_stats api_executor::get_stats()const
+{
+   api_executor_stats result;
+   result.num_threads = static_cast<uint32_t>( _workers.size() );
+   result.executed_calls = _executed_calls;
+   result.rejected_calls = _rejected_calls;
+   result.queue_depth = _queue_depth;
+   result.max_queue_depth = _max_queue_depth;
+   return result;
+}
+
+api_executor::worker& api_executor::acquire_worker()
+{
+   const uint32_t depth = ++_queue_depth;
+   if( depth > _max_queued_calls )
+   {
+      --_queue_depth;
+      ++_rejected_calls;
+      FC_THROW( "Too many pending calls to ${api}, please try again later", ("api", _api_name) );
+   }
+   uint32_t max_depth = _max_queue_depth;
+   while( depth > max_depth && !_max_queue_depth.compare_exchange_weak( max_depth, depth ) );
+
+   worker* least_busy = _workers.front().get();
+   for( auto& w : _workers )
+   {
+      if( w->queued_calls < least_busy->queued_calls )
+         least_busy = w.get();
+   }
+   ++least_busy->queued_calls;
+   return *least_busy;
+}
+
+void api_executor::release_worker( worker& w )
+{
+   --w.queued_calls;
+   --_queue_depth;
+   ++_executed_calls;
+}
+
+api_executor::call_slot::call_slot( api_executor& executor )
+: _executor( executor ), _worker( executor.acquire_worker() )
+{ // Nothing else to do
+}
+
+api_executor::call_slot::~call_slot()
+{
+   _executor.release_worker( _worker );
+}
+
+} } // graphene::app
@@ -281,6 +281,15 @@ void application_impl::initialize(const fc::path& data_dir, shared_ptr<boost::pr
    if ( _options->count("enable-subscribe-to-all") > 0 )
       _app_options.enable_subscribe_to_all = _options->at( "enable-subscribe-to-all" ).as<bool>();
 
+   if( _options->count("api-worker-threads") > 0 )
+      _app_options.api_worker_threads = _options->at("api-worker-threads").as<uint16_t>();
+
+   if( _options->count("api-max-queued-calls") > 0 )
+   {
+      _app_options.api_max_queued_calls = _options->at("api-max-queued-calls").as<uint32_t>();
+      FC_ASSERT( _app_options.api_max_queued_calls > 0, "api-max-queued-calls must be greater than 0" );
+   }
+
    set_api_limit();
 
    if( is_plugin_enabled( "market_history" ) )
@@ -474,6 +483,10 @@ void application_impl::set_api_limit() {
       _app_options.api_limit_get_storage_info =
             _options->at("api-limit-get-storage-info").as<uint32_t>();
    }
+   if(_options->count("api-limit-get-raw-blocks") > 0) {
+      _app_options.api_limit_get_raw_blocks =
+            _options->at("api-limit-get-raw-blocks").as<uint32_t>();
+   }
 }
 
 graphene::chain::genesis_state_type application_impl::initialize_genesis_state() const
@@ -554,6 +567,11 @@ void application_impl::open_chain_database() const
       _chain_db->enable_standby_votes_tracking( _options->at("enable-standby-votes-tracking").as<bool>() );
    }
 
+   if( _options->count("recent-transactions-cache-size") > 0 )
+   {
+      _chain_db->set_recent_transactions_cache_size( _options->at("recent-transactions-cache-size").as<uint32_t>() );
+   }
+
    if( _options->count("replay-blockchain") > 0 || _options->count("revalidate-blockchain") > 0 )
       _chain_db->wipe( _data_dir / "blockchain", false );
 
@@ -602,6 +620,8 @@ void application_impl::startup()
 
    open_chain_database();
 
+   reset_api_executors();
+
    startup_plugins();
 
    if( enable_p2p_network && _active_plugins.find( "delayed_node" ) == _active_plugins.end() )
@@ -611,6 +631,21 @@ void application_impl::startup()
    reset_websocket_tls_server();
 } FC_LOG_AND_RETHROW() }
 
+void application_impl::reset_api_executors()
+{
+   _api_executors.clear();
+   if( 0 == _app_options.api_worker_threads )
+      return;
+   for( const string api_name : { "database_api", "history_api", "asset_api", "orders_api" } )
+   {
+      _api_executors[api_name] = std::make_shared<api_executor>( api_name, *_chain_db,
+                                                                 _app_options.api_worker_threads,
+                                                                 _app_options.api_max_queued_calls );
+   }
+   ilog( "Started ${n} worker thread(s) for each of ${apis} APIs",
+         ("n", _app_options.api_worker_threads)("apis", _api_executors.size()) );
+}
+
 optional< api_access_info > application_impl::get_api_access_info(const string& username)const
 {
    optional< api_access_info > result;
@@ -661,21 +696,21 @@ bool application_impl::handle_block(const graphene::net::block_message& blk_msg,
                           std::vector<graphene::net::message_hash_type>& contained_transaction_msg_ids)
 { try {
 
-   auto latency = fc::time_point::now() - blk_msg.block.timestamp;
-   if (!sync_mode || blk_msg.block.block_num() % 10000 == 0)
+   auto latency = fc::time_point::now() - blk_msg.block->timestamp;
+   if (!sync_mode || blk_msg.block->block_num() % 10000 == 0)
    {
-      const auto& witness = blk_msg.block.witness(*_chain_db);
+      const auto& witness = blk_msg.block->witness(*_chain_db);
       const auto& witness_account = witness.witness_account(*_chain_db);
       auto last_irr = _chain_db->get_dynamic_global_properties().last_irreversible_block_num;
       ilog("Got block: #${n} ${bid} time: ${t} transaction(s): ${x} "
            "latency: ${l} ms from: ${w}  irreversible: ${i} (-${d})",
-           ("t",blk_msg.block.timestamp)
-           ("n", blk_msg.block.block_num())
-           ("bid", blk_msg.block.id())
-           ("x", blk_msg.block.transactions.size())
+           ("t",blk_msg.block->timestamp)
+           ("n", blk_msg.block->block_num())
+           ("bid", blk_msg.block->id())
+           ("x", blk_msg.block->transactions.size())
            ("l", (latency.count()/1000))
            ("w",witness_account.name)
-           ("i",last_irr)("d",blk_msg.block.block_num()-last_irr) );
+           ("i",last_irr)("d",blk_msg.block->block_num()-last_irr) );
    }
    GRAPHENE_ASSERT( latency.count()/1000 > -2500, // 2.5 seconds
                     graphene::net::block_timestamp_in_future_exception,
@@ -685,7 +720,7 @@ bool application_impl::handle_block(const graphene::net::block_message& blk_msg,
       const uint32_t skip = (_is_block_producer || _force_validate) ?
                                database::skip_nothing : database::skip_transaction_signatures;
       bool result = valve.do_serial( [this,&blk_msg,skip] () {
-         _chain_db->precompute_parallel( blk_msg.block, skip ).wait();
+         _chain_db->precompute_parallel( *blk_msg.block, skip ).wait();
       }, [this,&blk_msg,skip] () {
          // TODO: in the case where this block is valid but on a fork that's too old for us to switch to,
          // you can help the network code out by throwing a block_older_than_undo_history exception.
@@ -703,11 +738,13 @@ bool application_impl::handle_block(const graphene::net::block_message& blk_msg,
          // transaction message ids we no longer need.
          // during sync, it is unlikely that we'll see any old
          contained_transaction_msg_ids.reserve( contained_transaction_msg_ids.size()
-                                                    + blk_msg.block.transactions.size() );
-         for (const processed_transaction& ptrx : blk_msg.block.transactions)
+                                                    + blk_msg.block->transactions.size() );
+         for (const processed_transaction& ptrx : blk_msg.block->transactions)
          {
-            graphene::net::trx_message transaction_message(ptrx);
-            contained_transaction_msg_ids.emplace_back(graphene::net::message(transaction_message).id());
+            // a trx_message is serialized as the bare signed_transaction, so hash that directly
+            // instead of copying the transaction into a message
+            contained_transaction_msg_ids.emplace_back( graphene::net::message_hash_type::hash(
+                  static_cast<const graphene::protocol::signed_transaction&>( ptrx ) ) );
          }
       }
 
@@ -1084,6 +1121,9 @@ void application_impl::shutdown()
       _websocket_server.reset();
    // TODO wait until all connections are closed and messages handled?
 
+   // calls being executed by worker threads may still hold a read lock on the chain database
+   _api_executors.clear();
+
    // plugins E.G. witness_plugin may send data to p2p network, so shutdown them first
    ilog( "Shutting down plugins" );
    shutdown_plugins();
@@ -1221,11 +1261,20 @@ void application::set_program_options(boost::program_options::options_descriptio
          ("api-access", bpo::value<boost::filesystem::path>(), "JSON file specifying API permissions")
          ("io-threads", bpo::value<uint16_t>()->implicit_value(0),
           "Number of IO threads, default to 0 for auto-configuration")
+         ("api-worker-threads", bpo::value<uint16_t>()->default_value(default_opts.api_worker_threads),
+          "Number of worker threads executing read-only calls of each of database_api, history_api, asset_api "
+          "and orders_api, default to 0 for executing them on the main thread")
+         ("api-max-queued-calls", bpo::value<uint32_t>()->default_value(default_opts.api_max_queued_calls),
+          "Maximum number of read-only calls of each API being executed or waiting for a worker thread, "
+          "further calls are rejected. Only takes effect when api-worker-threads is greater than 0")
          ("enable-subscribe-to-all", bpo::value<bool>()->implicit_value(true),
           "Whether allow API clients to subscribe to universal object creation and removal events")
          ("enable-standby-votes-tracking", bpo::value<bool>()->implicit_value(true),
           "Whether to enable tracking of votes of standby witnesses and committee members. "
           "Set it to true to provide accurate data to API clients, set to false for slightly better performance.")
+         ("recent-transactions-cache-size", bpo::value<uint32_t>(),
+          "Maximum number of recently applied transactions to keep in memory for "
+          "database_api::get_recent_transaction_by_id and for serving peers, default to 100000")
          ("api-limit-get-account-history-operations",
           bpo::value<uint32_t>()->default_value(default_opts.api_limit_get_account_history_operations),
           "For history_api::get_account_history_operations to set max limit value")
@@ -1337,6 +1386,9 @@ void application::set_program_options(boost::program_options::options_descriptio
          ("api-limit-get-storage-info",
           bpo::value<uint32_t>()->default_value(default_opts.api_limit_get_storage_info),
           "Set maximum limit value for APIs which query for account storage info")
+         ("api-limit-get-raw-blocks",
+          bpo::value<uint32_t>()->default_value(default_opts.api_limit_get_raw_blocks),
+          "Set maximum number of blocks returned by the get_raw_blocks database API")
          ;
    command_line_options.add(configuration_file_options);
    command_line_options.add_options()
@@ -1388,7 +1440,11 @@ void application::set_api_limit()
 }
 std::shared_ptr<abstract_plugin> application::get_plugin(const string& name) const
 {
-   return my->_active_plugins[name];
+   // Do not insert into the map, this can be called concurrently by API worker threads
+   auto itr = my->_active_plugins.find( name );
+   if( itr == my->_active_plugins.end() )
+      return nullptr;
+   return itr->second;
 }
 
 bool application::is_plugin_enabled(const string& name) const
@@ -1441,6 +1497,22 @@ const application_options& application::get_options() const
    return my->_app_options;
 }
 
+std::shared_ptr<api_executor> application::get_api_executor( const string& api_name )const
+{
+   auto itr = my->_api_executors.find( api_name );
+   if( itr == my->_api_executors.end() )
+      return nullptr;
+   return itr->second;
+}
+
+std::map<string, api_executor_stats> application::get_api_executor_stats()const
+{
+   std::map<string, api_executor_stats> result;
+   for( const auto& entry : my->_api_executors )
+      result[entry.first] = entry.second->get_stats();
+   return result;
+}
+
 const string& application::get_node_info() const
 {
    return my->_node_info;
@@ -5,6 +5,7 @@
 
 #include <graphene/app/application.hpp>
 #include <graphene/app/api_access.hpp>
+#include <graphene/app/api_executor.hpp>
 #include <graphene/chain/genesis_state.hpp>
 #include <graphene/protocol/types.hpp>
 #include <graphene/net/message.hpp>
@@ -205,6 +206,8 @@ class application_impl : public net::node_delegate, public std::enable_shared_fr
       graphene::chain::genesis_state_type initialize_genesis_state() const;
       /// Open the chain database. Called by @ref startup.
       void open_chain_database() const;
+      /// Start worker threads for read-only API calls if configured. Called by @ref startup.
+      void reset_api_executors();
 
       friend class graphene::app::application;
 
@@ -219,6 +222,9 @@ class application_impl : public net::node_delegate, public std::enable_shared_fr
       std::shared_ptr<fc::http::websocket_server>      _websocket_server;
       std::shared_ptr<fc::http::websocket_tls_server>  _websocket_tls_server;
 
+      /// Executors of read-only API calls, by API name, empty if they run on the main thread
+      std::map<string, std::shared_ptr<api_executor>> _api_executors;
+
       std::map<string, std::shared_ptr<abstract_plugin>> _active_plugins;
       std::map<string, std::shared_ptr<abstract_plugin>> _available_plugins;
 
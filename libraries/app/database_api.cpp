@@ -38,6 +38,7 @@
 #include <boost/range/iterator_range.hpp>
 
 #include <cctype>
+#include <unordered_map>
 
 template class fc::api<graphene::app::database_api>;
 
@@ -49,8 +50,9 @@ namespace graphene { namespace app {
 //                                                                  //
 //////////////////////////////////////////////////////////////////////
 
-database_api::database_api( graphene::chain::database& db, const application_options* app_options )
-: my( std::make_shared<database_api_impl>( db, app_options ) )
+database_api::database_api( graphene::chain::database& db, const application_options* app_options,
+                            std::shared_ptr<api_executor> executor )
+: my( std::make_shared<database_api_impl>( db, app_options, std::move(executor) ) )
 { // Nothing else to do
 }
 
@@ -66,8 +68,9 @@ database_api_helper::database_api_helper( const graphene::app::application& app
 { // Nothing else to do
 }
 
-database_api_impl::database_api_impl( graphene::chain::database& db, const application_options* app_options )
-:database_api_helper( db, app_options )
+database_api_impl::database_api_impl( graphene::chain::database& db, const application_options* app_options,
+                                      std::shared_ptr<api_executor> executor )
+:database_api_helper( db, app_options ), _executor( std::move(executor) )
 {
    dlog("creating database api ${x}", ("x",int64_t(this)) );
    _new_connection = _db.new_objects.connect([this](const vector<object_id_type>& ids,
@@ -119,6 +122,16 @@ database_api_impl::database_api_impl( graphene::chain::database& db, const appli
       next_object_ids_index = nullptr;
    }
 
+   try
+   {
+      market_trade_log_index = &_db.get_index_type< primary_index< graphene::market_history::history_index > >()
+                                    .get_secondary_index<graphene::market_history::market_trade_log_index>();
+   }
+   catch( const fc::assert_exception& )
+   {
+      market_trade_log_index = nullptr;
+   }
+
 }
 
 database_api_impl::~database_api_impl()
@@ -150,7 +163,7 @@ fc::variants database_api_impl::get_objects( const vector<object_id_type>& ids,
       {
          if( to_subscribe && !id.is<operation_history_id_type>() && !id.is<account_history_id_type>() )
             this->subscribe_to_item( id );
-         return obj->to_variant();
+         return object_to_extended_variant( *obj );
       }
       return {};
    });
@@ -158,6 +171,40 @@ fc::variants database_api_impl::get_objects( const vector<object_id_type>& ids,
    return result;
 }
 
+fc::variant database_api_impl::object_to_extended_variant( const object& obj )const
+{
+   if( obj.id.is<asset_bitasset_data_id_type>() )
+   {
+      // The feeds are stored in separate objects, add them for compatibility
+      extended_asset_bitasset_data_object bitasset( static_cast<const asset_bitasset_data_object&>( obj ) );
+      bitasset.feeds = _db.get_bitasset_feeds( bitasset );
+      return fc::variant( bitasset, GRAPHENE_MAX_NESTED_OBJECTS );
+   }
+   return obj.to_variant();
+}
+
+vector<optional<vector<char>>> database_api::get_raw_objects( const vector<object_id_type>& ids )const
+{
+   return my->dispatch( [&]() { return my->get_raw_objects( ids ); } );
+}
+
+vector<optional<vector<char>>> database_api_impl::get_raw_objects( const vector<object_id_type>& ids )const
+{
+   vector<optional<vector<char>>> result;
+   result.reserve( ids.size() );
+
+   for( const auto& id : ids )
+   {
+      const object* obj = _db.find_object( id );
+      if( obj != nullptr )
+         result.emplace_back( obj->pack() );
+      else
+         result.emplace_back();
+   }
+
+   return result;
+}
+
 //////////////////////////////////////////////////////////////////////
 //                                                                  //
 // Subscriptions                                                    //
@@ -282,6 +329,46 @@ optional<signed_block> database_api_impl::get_block(uint32_t block_num)const
    return _db.fetch_block_by_number(block_num);
 }
 
+raw_block_range database_api::get_raw_blocks( uint32_t block_num_from, const optional<uint32_t>& limit )const
+{
+   return my->get_raw_blocks( block_num_from, limit );
+}
+
+raw_block_range database_api_impl::get_raw_blocks( uint32_t block_num_from, const optional<uint32_t>& olimit )const
+{
+   FC_ASSERT( _app_options, "Internal error" );
+   const auto configured_limit = _app_options->api_limit_get_raw_blocks;
+   uint32_t limit = olimit.valid() ? *olimit : configured_limit;
+   FC_ASSERT( limit <= configured_limit,
+              "limit can not be greater than ${configured_limit}",
+              ("configured_limit", configured_limit) );
+
+   // Keep responses well below the maximum websocket message size
+   static constexpr size_t max_response_size = 8 * 1024 * 1024;
+
+   raw_block_range result;
+   result.first_block_num = block_num_from;
+   if( 0 == limit )
+      return result;
+
+   const uint32_t head_num = _db.head_block_num();
+   size_t total_size = 0;
+   uint32_t block_num = std::max( block_num_from, 1u );
+   result.first_block_num = block_num;
+   for( ; block_num <= head_num && result.blocks.size() < limit && total_size < max_response_size; ++block_num )
+   {
+      auto packed = _db.fetch_packed_block_by_number( block_num );
+      if( !packed.valid() )
+         break;
+      total_size += packed->size();
+      result.blocks.emplace_back( std::move( *packed ) );
+   }
+
+   if( block_num <= head_num && !result.blocks.empty() )
+      result.next_block_num = block_num;
+   return result;
+}
+
 processed_transaction database_api::get_transaction( uint32_t block_num, uint32_t trx_in_block )const
 {
    return my->get_transaction( block_num, trx_in_block );
@@ -377,6 +464,16 @@ object_id_type database_api_impl::get_next_object_id( uint8_t space_id, uint8_t
    return next_object_ids_index->get_next_id( space_id, type_id );
 }
 
+vector<graphene::db::object_pool_statistics> database_api::get_object_pool_statistics()const
+{
+   return my->get_object_pool_statistics();
+}
+
+vector<graphene::db::object_pool_statistics> database_api_impl::get_object_pool_statistics()const
+{
+   return graphene::db::object_pool::get_all_statistics();
+}
+
 //////////////////////////////////////////////////////////////////////
 //                                                                  //
 // Keys                                                             //
@@ -385,7 +482,7 @@ object_id_type database_api_impl::get_next_object_id( uint8_t space_id, uint8_t
 
 vector<flat_set<account_id_type>> database_api::get_key_references( vector<public_key_type> key )const
 {
-   return my->get_key_references( key );
+   return my->dispatch( [&]() { return my->get_key_references( key ); } );
 }
 
 /**
@@ -421,22 +518,22 @@ vector<flat_set<account_id_type>> database_api_impl::get_key_references( vector<
 
       for( auto& a : {a1,a2,a3,a4,a5} )
       {
-          auto itr = refs.account_to_address_memberships.find(a);
-          if( itr != refs.account_to_address_memberships.end() )
+          const auto* accounts = refs.account_to_address_memberships.find(a);
+          if( accounts != nullptr )
           {
-             result.reserve( result.size() + itr->second.size() );
-             for( auto item : itr->second )
+             result.reserve( result.size() + accounts->size() );
+             for( auto item : *accounts )
              {
                 result.insert(item);
              }
           }
       }
 
-      auto itr = refs.account_to_key_memberships.find(key);
-      if( itr != refs.account_to_key_memberships.end() )
+      const auto* accounts = refs.account_to_key_memberships.find(key);
+      if( accounts != nullptr )
       {
-         result.reserve( result.size() + itr->second.size() );
-         for( auto item : itr->second ) result.insert(item);
+         result.reserve( result.size() + accounts->size() );
+         for( auto item : *accounts ) result.insert(item);
       }
       final_result.emplace_back( std::move(result) );
    }
@@ -472,8 +569,7 @@ bool database_api_impl::is_public_key_registered(string public_key) const
     const auto& idx = _db.get_index_type<account_index>();
     const auto& aidx = dynamic_cast<const base_primary_index&>(idx);
     const auto& refs = aidx.get_secondary_index<graphene::chain::account_member_index>();
-    auto itr = refs.account_to_key_memberships.find(key);
-    bool is_known = itr != refs.account_to_key_memberships.end();
+    bool is_known = ( refs.account_to_key_memberships.find(key) != nullptr );
 
     return is_known;
 }
@@ -700,7 +796,7 @@ std::map<std::string, full_account, std::less<>> database_api_impl::get_full_acc
 
 vector<account_statistics_object> database_api::get_top_voters(uint32_t limit)const
 {
-   return my->get_top_voters( limit );
+   return my->dispatch( [&]() { return my->get_top_voters( limit ); } );
 }
 
 vector<account_statistics_object> database_api_impl::get_top_voters(uint32_t limit)const
@@ -740,7 +836,7 @@ optional<account_object> database_api_impl::get_account_by_name( string name )co
 
 vector<account_id_type> database_api::get_account_references( const std::string account_id_or_name )const
 {
-   return my->get_account_references( account_id_or_name );
+   return my->dispatch( [&]() { return my->get_account_references( account_id_or_name ); } );
 }
 
 vector<account_id_type> database_api_impl::get_account_references( const std::string account_id_or_name )const
@@ -753,14 +849,11 @@ vector<account_id_type> database_api_impl::get_account_references( const std::st
    const auto& aidx = dynamic_cast<const base_primary_index&>(idx);
    const auto& refs = aidx.get_secondary_index<graphene::chain::account_member_index>();
    const account_id_type account_id = get_account_from_string(account_id_or_name)->get_id();
-   auto itr = refs.account_to_account_memberships.find(account_id);
+   const auto* accounts = refs.account_to_account_memberships.find(account_id);
    vector<account_id_type> result;
 
-   if( itr != refs.account_to_account_memberships.end() )
-   {
-      result.reserve( itr->second.size() );
-      for( auto item : itr->second ) result.push_back(item);
-   }
+   if( accounts != nullptr )
+      result.assign( accounts->begin(), accounts->end() );
    return result;
 }
 
@@ -1052,7 +1145,7 @@ vector<optional<extended_asset_object>> database_api_impl::lookup_asset_symbols(
 
 vector<limit_order_object> database_api::get_limit_orders(std::string a, std::string b, uint32_t limit)const
 {
-   return my->get_limit_orders( a, b, limit );
+   return my->dispatch( [&]() { return my->get_limit_orders( a, b, limit ); } );
 }
 
 vector<limit_order_object> database_api_impl::get_limit_orders( const std::string& a, const std::string& b,
@@ -1205,7 +1298,7 @@ vector<limit_order_object> database_api_impl::get_account_limit_orders(
 
 vector<call_order_object> database_api::get_call_orders(const std::string& a, uint32_t limit)const
 {
-   return my->get_call_orders( a, limit );
+   return my->dispatch( [&]() { return my->get_call_orders( a, limit ); } );
 }
 
 vector<call_order_object> database_api_impl::get_call_orders(const std::string& a, uint32_t limit)const
@@ -1261,7 +1354,7 @@ vector<call_order_object> database_api_impl::get_call_orders_by_account(const st
 
 vector<force_settlement_object> database_api::get_settle_orders(const std::string& a, uint32_t limit)const
 {
-   return my->get_settle_orders( a, limit );
+   return my->dispatch( [&]() { return my->get_settle_orders( a, limit ); } );
 }
 
 vector<force_settlement_object> database_api_impl::get_settle_orders(const std::string& a, uint32_t limit)const
@@ -1357,6 +1450,26 @@ vector<collateral_bid_object> database_api_impl::get_collateral_bids( const std:
    return result;
 } FC_CAPTURE_AND_RETHROW( (asset_id_or_symbol)(limit)(skip) ) }
 
+vector<asset_bitasset_feed_object> database_api::get_price_feeds( const std::string& a )const
+{
+   return my->get_price_feeds( a );
+}
+
+vector<asset_bitasset_feed_object> database_api_impl::get_price_feeds( const std::string& a )const
+{ try {
+   const asset_object& mia = *get_asset_from_string(a);
+   FC_ASSERT( mia.is_market_issued(), "Asset is not a MPA" );
+   const asset_id_type asset_id = mia.get_id();
+   const auto& idx = _db.get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>();
+   auto itr = idx.lower_bound( std::make_tuple( asset_id ) );
+   vector<asset_bitasset_feed_object> result;
+   for( ; itr != idx.end() && itr->asset_id == asset_id; ++itr )
+   {
+      result.push_back(*itr);
+   }
+   return result;
+} FC_CAPTURE_AND_RETHROW( (a) ) }
+
 void database_api::subscribe_to_market( std::function<void(const variant&)> callback,
                                         const std::string& a, const std::string& b )
 {
@@ -1391,7 +1504,7 @@ void database_api_impl::unsubscribe_from_market(const std::string& a, const std:
 
 market_ticker database_api::get_ticker( const string& base, const string& quote )const
 {
-    return my->get_ticker( base, quote );
+    return my->dispatch( [&]() { return my->get_ticker( base, quote ); } );
 }
 
 market_ticker database_api_impl::get_ticker( const string& base, const string& quote, bool skip_order_book )const
@@ -1425,7 +1538,7 @@ market_ticker database_api_impl::get_ticker( const string& base, const string& q
 
 market_volume database_api::get_24_volume( const string& base, const string& quote )const
 {
-    return my->get_24_volume( base, quote );
+    return my->dispatch( [&]() { return my->get_24_volume( base, quote ); } );
 }
 
 market_volume database_api_impl::get_24_volume( const string& base, const string& quote )const
@@ -1444,7 +1557,7 @@ market_volume database_api_impl::get_24_volume( const string& base, const string
 
 order_book database_api::get_order_book( const string& base, const string& quote, uint32_t limit )const
 {
-   return my->get_order_book( base, quote, limit );
+   return my->dispatch( [&]() { return my->get_order_book( base, quote, limit ); } );
 }
 
 order_book database_api_impl::get_order_book( const string& base, const string& quote, uint32_t limit )const
@@ -1493,7 +1606,7 @@ order_book database_api_impl::get_order_book( const string& base, const string&
 
 vector<market_ticker> database_api::get_top_markets(uint32_t limit)const
 {
-   return my->get_top_markets(limit);
+   return my->dispatch( [&]() { return my->get_top_markets(limit); } );
 }
 
 vector<market_ticker> database_api_impl::get_top_markets(uint32_t limit)const
@@ -1530,7 +1643,7 @@ vector<market_trade> database_api::get_trade_history( const string& base,
                                                       fc::time_point_sec stop,
                                                       uint32_t limit )const
 {
-   return my->get_trade_history( base, quote, start, stop, limit );
+   return my->dispatch( [&]() { return my->get_trade_history( base, quote, start, stop, limit ); } );
 }
 
 vector<market_trade> database_api_impl::get_trade_history( const string& base,
@@ -1539,7 +1652,8 @@ vector<market_trade> database_api_impl::get_trade_history( const string& base,
                                                            fc::time_point_sec stop,
                                                            uint32_t limit )const
 {
-   FC_ASSERT( _app_options && _app_options->has_market_history_plugin, "Market history plugin is not enabled." );
+   FC_ASSERT( _app_options && _app_options->has_market_history_plugin && market_trade_log_index,
+              "Market history plugin is not enabled." );
 
    const auto configured_limit = _app_options->api_limit_get_trade_history;
    FC_ASSERT( limit <= configured_limit,
@@ -1558,59 +1672,62 @@ vector<market_trade> database_api_impl::get_trade_history( const string& base,
    if ( start.sec_since_epoch() == 0 )
       start = fc::time_point_sec( fc::time_point::now() );
 
-   uint32_t count = 0;
-   const auto& history_idx = _db.get_index_type<market_history::history_index>().indices().get<by_market_time>();
-   auto itr = history_idx.lower_bound( std::make_tuple( base_id, quote_id, start ) );
    vector<market_trade> result;
+   const auto* log = market_trade_log_index->get_market_log( base_id, quote_id );
+   if( log == nullptr )
+      return result;
+
+   uint32_t count = 0;
+   auto itr = market_history::market_trade_log_index::lower_bound_by_time( *log, start );
 
-   while( itr != history_idx.end() && count < limit
-          && !( itr->key.base != base_id || itr->key.quote != quote_id || itr->time < stop ) )
+   while( itr != log->end() && count < limit && !( (*itr)->time < stop ) )
    {
+      const order_history_object& his = **itr;
       {
          market_trade trade;
 
-         if( assets[0]->id == itr->op.receives.asset_id )
+         if( assets[0]->id == his.op.receives.asset_id )
          {
-            trade.amount = assets[1]->amount_to_string( itr->op.pays );
-            trade.value = assets[0]->amount_to_string( itr->op.receives );
+            trade.amount = assets[1]->amount_to_string( his.op.pays );
+            trade.value = assets[0]->amount_to_string( his.op.receives );
          }
          else
          {
-            trade.amount = assets[1]->amount_to_string( itr->op.receives );
-            trade.value = assets[0]->amount_to_string( itr->op.pays );
+            trade.amount = assets[1]->amount_to_string( his.op.receives );
+            trade.value = assets[0]->amount_to_string( his.op.pays );
          }
 
-         trade.date = itr->time;
-         trade.price = price_to_string( itr->op.fill_price, *assets[0], *assets[1] );
+         trade.date = his.time;
+         trade.price = price_to_string( his.op.fill_price, *assets[0], *assets[1] );
 
-         if( itr->op.is_maker )
+         if( his.op.is_maker )
          {
-            trade.sequence = -itr->key.sequence;
-            trade.side1_account_id = itr->op.account_id;
-            if(itr->op.receives.asset_id == assets[0]->id)
+            trade.sequence = -his.key.sequence;
+            trade.side1_account_id = his.op.account_id;
+            if(his.op.receives.asset_id == assets[0]->id)
                trade.type = "sell";
             else
                trade.type = "buy";
          }
          else
-            trade.side2_account_id = itr->op.account_id;
+            trade.side2_account_id = his.op.account_id;
 
          auto next_itr = std::next(itr);
+         const order_history_object* next_his = ( next_itr != log->end() ? *next_itr : nullptr );
          // Trades are usually tracked in each direction, exception: for global settlement only one side is recorded
-         if( next_itr != history_idx.end() && next_itr->key.base == base_id && next_itr->key.quote == quote_id
-             && next_itr->time == itr->time && next_itr->op.is_maker != itr->op.is_maker )
+         if( next_his != nullptr && next_his->time == his.time && next_his->op.is_maker != his.op.is_maker )
          {  // next_itr now could be the other direction // FIXME not 100% sure
-            if( next_itr->op.is_maker )
+            if( next_his->op.is_maker )
             {
-               trade.sequence = -next_itr->key.sequence;
-               trade.side1_account_id = next_itr->op.account_id;
-               if(next_itr->op.receives.asset_id == assets[0]->id)
+               trade.sequence = -next_his->key.sequence;
+               trade.side1_account_id = next_his->op.account_id;
+               if(next_his->op.receives.asset_id == assets[0]->id)
                   trade.type = "sell";
                else
                   trade.type = "buy";
             }
             else
-               trade.side2_account_id = next_itr->op.account_id;
+               trade.side2_account_id = next_his->op.account_id;
             // skip the other direction
             itr = next_itr;
          }
@@ -1632,7 +1749,7 @@ vector<market_trade> database_api::get_trade_history_by_sequence(
                                                       fc::time_point_sec stop,
                                                       uint32_t limit )const
 {
-   return my->get_trade_history_by_sequence( base, quote, start, stop, limit );
+   return my->dispatch( [&]() { return my->get_trade_history_by_sequence( base, quote, start, stop, limit ); } );
 }
 
 vector<market_trade> database_api_impl::get_trade_history_by_sequence(
@@ -1642,7 +1759,8 @@ vector<market_trade> database_api_impl::get_trade_history_by_sequence(
                                                            fc::time_point_sec stop,
                                                            uint32_t limit )const
 {
-   FC_ASSERT( _app_options && _app_options->has_market_history_plugin, "Market history plugin is not enabled." );
+   FC_ASSERT( _app_options && _app_options->has_market_history_plugin && market_trade_log_index,
+              "Market history plugin is not enabled." );
 
    const auto configured_limit = _app_options->api_limit_get_trade_history_by_sequence;
    FC_ASSERT( limit <= configured_limit,
@@ -1660,24 +1778,22 @@ vector<market_trade> database_api_impl::get_trade_history_by_sequence(
    auto quote_id = assets[1]->get_id();
 
    if( base_id > quote_id ) std::swap( base_id, quote_id );
-   const auto& history_idx = _db.get_index_type<graphene::market_history::history_index>().indices().get<by_key>();
-   history_key hkey;
-   hkey.base = base_id;
-   hkey.quote = quote_id;
-   hkey.sequence = start_seq;
+   vector<market_trade> result;
+   const auto* log = market_trade_log_index->get_market_log( base_id, quote_id );
+   if( log == nullptr )
+      return result;
 
    uint32_t count = 0;
-   auto itr = history_idx.lower_bound( hkey );
-   vector<market_trade> result;
+   auto itr = market_history::market_trade_log_index::lower_bound_by_sequence( *log, start_seq );
 
-   while( itr != history_idx.end() && count < limit
-          && !( itr->key.base != base_id || itr->key.quote != quote_id || itr->time < stop ) )
+   while( itr != log->end() && count < limit && !( (*itr)->time < stop ) )
    {
-      if( itr->key.sequence == start_seq ) // found the key, should skip this and the other direction if found
+      const order_history_object& his = **itr;
+      if( his.key.sequence == start_seq ) // found the key, should skip this and the other direction if found
       {
          auto next_itr = std::next(itr);
-         if( next_itr != history_idx.end() && next_itr->key.base == base_id && next_itr->key.quote == quote_id
-             && next_itr->time == itr->time && next_itr->op.is_maker != itr->op.is_maker )
+         const order_history_object* next_his = ( next_itr != log->end() ? *next_itr : nullptr );
+         if( next_his != nullptr && next_his->time == his.time && next_his->op.is_maker != his.op.is_maker )
          {  // next_itr now could be the other direction // FIXME not 100% sure
             // skip the other direction
             itr = next_itr;
@@ -1687,48 +1803,48 @@ vector<market_trade> database_api_impl::get_trade_history_by_sequence(
       {
          market_trade trade;
 
-         if( assets[0]->id == itr->op.receives.asset_id )
+         if( assets[0]->id == his.op.receives.asset_id )
          {
-            trade.amount = assets[1]->amount_to_string( itr->op.pays );
-            trade.value = assets[0]->amount_to_string( itr->op.receives );
+            trade.amount = assets[1]->amount_to_string( his.op.pays );
+            trade.value = assets[0]->amount_to_string( his.op.receives );
          }
          else
          {
-            trade.amount = assets[1]->amount_to_string( itr->op.receives );
-            trade.value = assets[0]->amount_to_string( itr->op.pays );
+            trade.amount = assets[1]->amount_to_string( his.op.receives );
+            trade.value = assets[0]->amount_to_string( his.op.pays );
          }
 
-         trade.date = itr->time;
-         trade.price = price_to_string( itr->op.fill_price, *assets[0], *assets[1] );
+         trade.date = his.time;
+         trade.price = price_to_string( his.op.fill_price, *assets[0], *assets[1] );
 
-         if( itr->op.is_maker )
+         if( his.op.is_maker )
          {
-            trade.sequence = -itr->key.sequence;
-            trade.side1_account_id = itr->op.account_id;
-            if(itr->op.receives.asset_id == assets[0]->id)
+            trade.sequence = -his.key.sequence;
+            trade.side1_account_id = his.op.account_id;
+            if(his.op.receives.asset_id == assets[0]->id)
                trade.type = "sell";
             else
                trade.type = "buy";
          }
          else
-            trade.side2_account_id = itr->op.account_id;
+            trade.side2_account_id = his.op.account_id;
 
          auto next_itr = std::next(itr);
+         const order_history_object* next_his = ( next_itr != log->end() ? *next_itr : nullptr );
          // Trades are usually tracked in each direction, exception: for global settlement only one side is recorded
-         if( next_itr != history_idx.end() && next_itr->key.base == base_id && next_itr->key.quote == quote_id
-             && next_itr->time == itr->time && next_itr->op.is_maker != itr->op.is_maker )
+         if( next_his != nullptr && next_his->time == his.time && next_his->op.is_maker != his.op.is_maker )
          {  // next_itr now could be the other direction // FIXME not 100% sure
-            if( next_itr->op.is_maker )
+            if( next_his->op.is_maker )
             {
-               trade.sequence = -next_itr->key.sequence;
-               trade.side1_account_id = next_itr->op.account_id;
-               if(next_itr->op.receives.asset_id == assets[0]->id)
+               trade.sequence = -next_his->key.sequence;
+               trade.side1_account_id = next_his->op.account_id;
+               if(next_his->op.receives.asset_id == assets[0]->id)
                   trade.type = "sell";
                else
                   trade.type = "buy";
             }
             else
-               trade.side2_account_id = next_itr->op.account_id;
+               trade.side2_account_id = next_his->op.account_id;
             // skip the other direction
             itr = next_itr;
          }
@@ -3158,13 +3274,53 @@ bool database_api_impl::is_impacted_account( const flat_set<account_id_type>& ac
    });
 }
 
-void database_api_impl::broadcast_updates( const vector<variant>& updates )
+namespace {
+
+/**
+ * The objects which were created or changed in a block are sent to every connection which subscribed to them,
+ * so the same object would be converted to a variant once per connection. This cache keeps the variants of
+ * the head block, copying a variant object only copies a shared pointer.
+ * It is only used by the thread which applies blocks, while the database emits its object notifications.
+ */
+class object_variant_cache
+{
+   public:
+      template< typename Converter >
+      fc::variant get( const graphene::chain::database& db, const object& obj, const Converter& convert )
+      {
+         if( &db != _db || db.head_block_id() != _block_id )
+         {
+            _variants.clear();
+            _db = &db;
+            _block_id = db.head_block_id();
+         }
+         auto itr = _variants.find( obj.id );
+         if( itr == _variants.end() )
+            itr = _variants.emplace( obj.id, convert( obj ) ).first;
+         return itr->second;
+      }
+
+   private:
+      const graphene::chain::database* _db = nullptr;
+      block_id_type _block_id;
+      std::unordered_map< object_id_type, fc::variant > _variants;
+};
+
+} // anonymous namespace
+
+fc::variant database_api_impl::object_to_variant( const object& obj )const
+{
+   static object_variant_cache cache;
+   return cache.get( _db, obj, [this]( const object& o ) { return object_to_extended_variant( o ); } );
+}
+
+void database_api_impl::broadcast_updates( vector<variant>&& updates )
 {
    if( !updates.empty() && _subscribe_callback ) {
       auto capture_this = shared_from_this();
-      fc::async([capture_this,updates](){
+      fc::async([capture_this,updates = fc::variant( std::move(updates) )](){
           if(capture_this->_subscribe_callback)
-            capture_this->_subscribe_callback( fc::variant(updates) );
+            capture_this->_subscribe_callback( updates );
       });
    }
 }
@@ -3228,9 +3384,19 @@ void database_api_impl::handle_object_changed( bool force_notify,
    if( _subscribe_callback )
    {
       vector<variant> updates;
+      // Bitasset data objects whose feeds changed, their variants include the feeds
+      flat_set<object_id_type> bitassets_with_changed_feeds;
 
       for(auto id : ids)
       {
+         if( id.is<asset_bitasset_feed_id_type>() )
+         {
+            const auto* feed = dynamic_cast<const asset_bitasset_feed_object*>( find_object(id) );
+            const asset_object* asset = ( feed != nullptr ) ? _db.find( feed->asset_id ) : nullptr;
+            if( asset != nullptr && asset->bitasset_data_id.valid() && is_subscribed_to_item( *asset->bitasset_data_id )
+                  && std::find( ids.begin(), ids.end(), object_id_type( *asset->bitasset_data_id ) ) == ids.end() )
+               bitassets_with_changed_feeds.insert( object_id_type( *asset->bitasset_data_id ) );
+         }
          if( force_notify || is_subscribed_to_item(id) || is_impacted_account(impacted_accounts) )
          {
             if( full_object )
@@ -3238,7 +3404,7 @@ void database_api_impl::handle_object_changed( bool force_notify,
                auto obj = find_object(id);
                if( obj )
                {
-                  updates.emplace_back( obj->to_variant() );
+                  updates.emplace_back( object_to_variant( *obj ) );
                }
             }
             else
@@ -3248,8 +3414,15 @@ void database_api_impl::handle_object_changed( bool force_notify,
          }
       }
 
+      for( const auto& id : bitassets_with_changed_feeds )
+      {
+         const object* obj = _db.find_object( id );
+         if( obj != nullptr )
+            updates.emplace_back( object_to_variant( *obj ) );
+      }
+
       if( !updates.empty() )
-         broadcast_updates(updates);
+         broadcast_updates( std::move(updates) );
    }
 
    if( !_market_subscriptions.empty() )
@@ -23,6 +23,8 @@
  */
 #pragma once
 
+#include <graphene/app/api_executor.hpp>
+
 #include <fc/bloom_filter.hpp>
 #include "database_api_helper.hxx"
 
@@ -36,11 +38,13 @@ using market_queue_type = std::map< std::pair<graphene::chain::asset_id_type, gr
 class database_api_impl : public std::enable_shared_from_this<database_api_impl>, public database_api_helper
 {
    public:
-      database_api_impl( graphene::chain::database& db, const application_options* app_options );
+      database_api_impl( graphene::chain::database& db, const application_options* app_options,
+                         std::shared_ptr<api_executor> executor = nullptr );
       virtual ~database_api_impl();
 
       // Objects
       fc::variants get_objects( const vector<object_id_type>& ids, optional<bool> subscribe )const;
+      vector<optional<vector<char>>> get_raw_objects( const vector<object_id_type>& ids )const;
 
       // Subscriptions
       void set_subscribe_callback( std::function<void(const variant&)> cb, bool notify_remove_create );
@@ -54,6 +58,7 @@ class database_api_impl : public std::enable_shared_from_this<database_api_impl>
       map<uint32_t, optional<maybe_signed_block_header>> get_block_header_batch(
             const vector<uint32_t>& block_nums, bool with_witness_signatures )const;
       optional<signed_block> get_block(uint32_t block_num)const;
+      raw_block_range get_raw_blocks( uint32_t block_num_from, const optional<uint32_t>& limit )const;
       processed_transaction get_transaction( uint32_t block_num, uint32_t trx_in_block )const;
 
       // Globals
@@ -63,6 +68,7 @@ class database_api_impl : public std::enable_shared_from_this<database_api_impl>
       chain_id_type get_chain_id()const;
       dynamic_global_property_object get_dynamic_global_properties()const;
       object_id_type get_next_object_id( uint8_t space_id, uint8_t type_id, bool with_pending_transactions )const;
+      vector<graphene::db::object_pool_statistics> get_object_pool_statistics()const;
 
       // Keys
       vector<flat_set<account_id_type>> get_key_references( vector<public_key_type> key )const;
@@ -119,6 +125,7 @@ class database_api_impl : public std::enable_shared_from_this<database_api_impl>
                                                                       uint32_t limit)const;
       vector<collateral_bid_object>      get_collateral_bids( const std::string& asset,
                                                               uint32_t limit, uint32_t start)const;
+      vector<asset_bitasset_feed_object> get_price_feeds( const std::string& a )const;
 
       void subscribe_to_market( std::function<void(const variant&)> callback,
                                 const std::string& a, const std::string& b );
@@ -390,11 +397,16 @@ class database_api_impl : public std::enable_shared_from_this<database_api_impl>
 
          auto sub = _market_subscriptions.find( market );
          if( sub != _market_subscriptions.end() ) {
-            queue[market].emplace_back( full_object ? obj->to_variant() : fc::variant(obj->id, 1) );
+            queue[market].emplace_back( full_object ? object_to_variant( *obj ) : fc::variant(obj->id, 1) );
          }
       }
 
-      void broadcast_updates( const vector<variant>& updates );
+      /// Returns @p obj converted to a variant, with the price feeds added to bitasset data objects
+      fc::variant object_to_extended_variant( const object& obj )const;
+      /// Returns @p obj converted to a variant, the conversion is shared by all connections in the same block
+      fc::variant object_to_variant( const object& obj )const;
+
+      void broadcast_updates( vector<variant>&& updates );
       void broadcast_market_updates( const market_queue_type& queue);
       void handle_object_changed( bool force_notify,
                                   bool full_object,
@@ -413,6 +425,18 @@ class database_api_impl : public std::enable_shared_from_this<database_api_impl>
       // Member variables
       ////////////////////////////////////////////////
 
+      /// Executes read-only calls which do not subscribe to anything, null if they run on the main thread
+      std::shared_ptr<api_executor> _executor;
+
+      /// Execute @p f by @ref _executor if there is one, otherwise directly
+      template<typename Functor>
+      auto dispatch( Functor&& f )const -> decltype( f() )
+      {
+         if( _executor )
+            return _executor->run( std::forward<Functor>( f ) );
+         return f();
+      }
+
       bool _notify_remove_create = false;
       bool _enabled_auto_subscription = true;
 
@@ -434,6 +458,7 @@ class database_api_impl : public std::enable_shared_from_this<database_api_impl>
       const graphene::api_helper_indexes::amount_in_collateral_index* amount_in_collateral_index;
       const graphene::api_helper_indexes::asset_in_liquidity_pools_index* asset_in_liquidity_pools_index;
       const graphene::api_helper_indexes::next_object_ids_index* next_object_ids_index;
+      const graphene::market_history::market_trade_log_index* market_trade_log_index;
 };
 
 } } // graphene::app
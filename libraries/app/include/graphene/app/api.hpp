@@ -23,6 +23,7 @@
  */
 #pragma once
 
+#include <graphene/app/api_executor.hpp>
 #include <graphene/app/database_api.hpp>
 
 #include <graphene/protocol/types.hpp>
@@ -301,6 +302,8 @@ namespace graphene { namespace app {
 
       private:
            application& _app;
+           /// Executes read-only calls, null if they run on the main thread
+           std::shared_ptr<api_executor> _executor;
    };
 
    /**
@@ -429,6 +432,12 @@ namespace graphene { namespace app {
           */
          std::vector<net::potential_peer_record> get_potential_peers() const;
 
+         /**
+          * @brief Get counters of the worker threads executing read-only API calls, by API name
+          * @return An empty map if read-only API calls are executed on the main thread
+          */
+         std::map<string, api_executor_stats> get_api_executor_stats() const;
+
       private:
          application& _app;
    };
@@ -589,6 +598,8 @@ namespace graphene { namespace app {
       private:
          graphene::app::application& _app;
          graphene::chain::database& _db;
+         /// Executes read-only calls, null if they run on the main thread
+         std::shared_ptr<api_executor> _executor;
    };
 
    /**
@@ -632,6 +643,9 @@ namespace graphene { namespace app {
           * @param limit Maximum number of order groups to retrieve, must not exceed the configured value of
           *              @a api_limit_get_grouped_limit_orders
           * @return The grouped limit orders, ordered from best offered price to worst
+          *
+          * @note The result reflects the state as of the last applied block, it does not include changes made by
+          *       pending transactions.
           */
          vector< limit_order_group > get_grouped_limit_orders( const std::string& base_asset,
                                                                const std::string& quote_asset,
@@ -641,6 +655,8 @@ namespace graphene { namespace app {
 
       private:
          application& _app;
+         /// Executes read-only calls, null if they run on the main thread
+         std::shared_ptr<api_executor> _executor;
    };
 
    /**
@@ -852,6 +868,7 @@ FC_API(graphene::app::network_node_api,
        (get_potential_peers)
        (get_advanced_node_parameters)
        (set_advanced_node_parameters)
+       (get_api_executor_stats)
      )
 FC_API(graphene::app::crypto_api,
        (blind)
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <graphene/chain/database.hpp>
+
+#include <fc/thread/thread.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace graphene { namespace app {
+
+   /// Counters of an @ref api_executor
+   struct api_executor_stats
+   {
+      uint32_t num_threads = 0;     ///< Number of worker threads
+      uint64_t executed_calls = 0;  ///< Number of calls which have been executed by the worker threads
+      uint64_t rejected_calls = 0;  ///< Number of calls which were rejected because too many calls were queued
+      uint32_t queue_depth = 0;     ///< Number of calls which are being executed or waiting for a worker thread
+      uint32_t max_queue_depth = 0; ///< The highest value of queue_depth seen since startup
+   };
+
+   /**
+    * @brief Executes read-only API calls on a dedicated pool of worker threads
+    *
+    * By default every API call is executed by the thread which runs the chain, so one slow query delays all other
+    * clients and block processing. An executor moves the execution of a call to one of its worker threads, where it
+    * runs while holding @ref graphene::chain::database::read_lock, concurrently with calls of other clients.
+    *
+    * Only calls which do not modify any state shared with the main thread (E.G. subscriptions) may be dispatched
+    * to an executor. Calls made from a worker thread, E.G. by one API calling another, are executed inline.
+    */
+   class api_executor
+   {
+   public:
+      /**
+       * @param api_name Name of the API, used for naming the worker threads and in error messages
+       * @param db The database to lock while a call is being executed
+       * @param num_threads Number of worker threads, which is also the maximum number of concurrent calls
+       * @param max_queued_calls Maximum number of calls which are being executed or waiting, calls exceeding it
+       *                         are rejected
+       */
+      api_executor( const std::string& api_name, const graphene::chain::database& db,
+                    uint16_t num_threads, uint32_t max_queued_calls );
+      ~api_executor();
+
+      /// Execute @p f on a worker thread and wait for the result
+      template<typename Functor>
+      auto run( Functor&& f ) -> decltype( f() )
+      {
+         if( in_worker_thread() )
+            return f();
+         call_slot slot( *this );
+         return slot.get_thread().async( [this,&f]() {
+            auto lock = _db.read_lock();
+            return f();
+         }, "api_executor::run" ).wait();
+      }
+
+      api_executor_stats get_stats()const;
+
+      /// @return whether the current thread is a worker thread of any executor
+      static bool in_worker_thread();
+
+   private:
+      struct worker
+      {
+         explicit worker( const std::string& name ) : thread( name ) {}
+         fc::thread            thread;
+         std::atomic<uint32_t> queued_calls { 0 };
+      };
+
+      /// Reserves a place in the queue of the least busy worker for one call, throws if the queue is full
+      class call_slot
+      {
+      public:
+         explicit call_slot( api_executor& executor );
+         ~call_slot();
+         fc::thread& get_thread()const { return _worker.thread; }
+      private:
+         api_executor& _executor;
+         worker&       _worker;
+      };
+
+      worker& acquire_worker();
+      void    release_worker( worker& w );
+
+      const std::string                     _api_name;
+      const graphene::chain::database&      _db;
+      const uint32_t                        _max_queued_calls;
+      std::vector<std::unique_ptr<worker>>  _workers;
+
+      std::atomic<uint64_t>                 _executed_calls { 0 };
+      std::atomic<uint64_t>                 _rejected_calls { 0 };
+      std::atomic<uint32_t>                 _queue_depth { 0 };
+      std::atomic<uint32_t>                 _max_queue_depth { 0 };
+   };
+
+} } // graphene::app
+
+FC_REFLECT( graphene::app::api_executor_stats,
+            (num_threads)(executed_calls)(rejected_calls)(queue_depth)(max_queue_depth) )
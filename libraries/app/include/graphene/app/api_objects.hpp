@@ -168,6 +168,18 @@ namespace graphene { namespace app {
       optional<share_type> total_backing_collateral;
    };
 
+   struct extended_asset_bitasset_data_object : asset_bitasset_data_object
+   {
+      extended_asset_bitasset_data_object() {}
+      explicit extended_asset_bitasset_data_object( const asset_bitasset_data_object& o )
+      : asset_bitasset_data_object( o ) {}
+      explicit extended_asset_bitasset_data_object( asset_bitasset_data_object&& o )
+      : asset_bitasset_data_object( std::move(o) ) {}
+
+      /// The feeds and their publication time by feed producer, stored in @ref asset_bitasset_feed_object
+      flat_map<account_id_type, pair<time_point_sec,price_feed_with_icr>> feeds;
+   };
+
    struct extended_liquidity_pool_object : liquidity_pool_object
    {
       extended_liquidity_pool_object() {}
@@ -185,6 +197,16 @@ namespace graphene { namespace app {
       optional<signature_type> witness_signature;
    };
 
+   /// A range of consecutive blocks in serialized form, as returned by @ref database_api::get_raw_blocks
+   struct raw_block_range
+   {
+      uint32_t               first_block_num = 0;
+      /// Serialized @ref signed_block objects, first one is block number @ref first_block_num
+      vector<vector<char>>   blocks;
+      /// If valid, the block number to start with in the next call, there might be more blocks available
+      optional<uint32_t>     next_block_num;
+   };
+
 } }
 
 FC_REFLECT( graphene::app::more_data,
@@ -227,8 +249,14 @@ FC_REFLECT( graphene::app::market_trade, (sequence)(date)(price)(amount)(value)(
 FC_REFLECT_DERIVED( graphene::app::extended_asset_object, (graphene::chain::asset_object),
                     (total_in_collateral)(total_backing_collateral) )
 
+FC_REFLECT_DERIVED( graphene::app::extended_asset_bitasset_data_object,
+                    (graphene::chain::asset_bitasset_data_object),
+                    (feeds) )
+
 FC_REFLECT_DERIVED( graphene::app::extended_liquidity_pool_object, (graphene::chain::liquidity_pool_object),
                     (statistics) )
 
 FC_REFLECT_DERIVED( graphene::app::maybe_signed_block_header, (graphene::protocol::block_header),
                     (witness_signature) )
+
+FC_REFLECT( graphene::app::raw_block_range, (first_block_num)(blocks)(next_block_num) )
@@ -34,6 +34,8 @@ namespace graphene { namespace app {
    using std::string;
 
    class abstract_plugin;
+   class api_executor;
+   struct api_executor_stats;
 
    class application_options
    {
@@ -80,6 +82,12 @@ namespace graphene { namespace app {
          uint32_t api_limit_get_samet_funds = 101;
          uint32_t api_limit_get_credit_offers = 101;
          uint32_t api_limit_get_storage_info = 101;
+         uint32_t api_limit_get_raw_blocks = 1000;
+
+         /// Number of worker threads executing read-only calls of each API, 0 to execute them on the main thread
+         uint16_t api_worker_threads = 0;
+         /// Maximum number of read-only calls of each API being executed or waiting for a worker thread
+         uint32_t api_max_queued_calls = 1000;
 
          static constexpr application_options get_default()
          {
@@ -157,6 +165,11 @@ namespace graphene { namespace app {
 
          std::shared_ptr<fc::thread> elasticsearch_thread;
 
+         /// @return the executor of read-only calls of the API, or a null pointer if they run on the main thread
+         std::shared_ptr<api_executor> get_api_executor( const string& api_name )const;
+         /// @return counters of all API executors, by API name
+         std::map<string, api_executor_stats> get_api_executor_stats()const;
+
          const string& get_node_info() const;
 
    private:
@@ -212,6 +225,9 @@ FC_REFLECT( graphene::app::application_options,
             ( api_limit_get_samet_funds )
             ( api_limit_get_credit_offers )
             ( api_limit_get_storage_info )
+            ( api_limit_get_raw_blocks )
+            ( api_worker_threads )
+            ( api_max_queued_calls )
           )
 
 GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::app::application_options )
@@ -59,6 +59,7 @@ using std::vector;
 using std::map;
 
 class database_api_impl;
+class api_executor;
 
 /**
  * @brief The database_api class implements the RPC API for the chain database.
@@ -70,7 +71,8 @@ class database_api_impl;
 class database_api
 {
    public:
-      database_api(graphene::chain::database& db, const application_options* app_options = nullptr );
+      database_api( graphene::chain::database& db, const application_options* app_options = nullptr,
+                    std::shared_ptr<api_executor> executor = nullptr );
       ~database_api();
 
       /////////////
@@ -92,6 +94,16 @@ class database_api
       fc::variants get_objects( const vector<object_id_type>& ids,
                                 optional<bool> subscribe = optional<bool>() )const;
 
+      /**
+       * @brief Get the objects corresponding to the provided IDs in serialized (packed) form
+       * @param ids IDs of the objects to retrieve
+       * @return The serialized objects, in the order they are mentioned in ids
+       *
+       * The type of each object is determined by its ID. If any of the provided IDs does not map to an object,
+       * null is returned in its position. This function does not subscribe to the queried objects.
+       */
+      vector<optional<vector<char>>> get_raw_objects( const vector<object_id_type>& ids )const;
+
       ///////////////////
       // Subscriptions //
       ///////////////////
@@ -181,6 +193,21 @@ class database_api
        */
       optional<signed_block> get_block(uint32_t block_num)const;
 
+      /**
+       * @brief Retrieve a range of consecutive blocks in serialized (packed) form
+       * @param block_num_from Height of the first block to be returned
+       * @param limit Maximum number of blocks to return, must not exceed the configured value of
+       *              @a api_limit_get_raw_blocks. Optional. If omitted, the configured value is used.
+       * @return the serialized blocks, starting from @p block_num_from and stopping at the first missing block,
+       *         after @p limit blocks or when the response grows too large, whichever comes first.
+       *         @a next_block_num is set when the range was cut short, in which case the caller should
+       *         continue with it.
+       *
+       * The blocks are read directly from the block log and are returned as stored, i.e. they are not
+       * deserialized and validated on the server side, which makes this API suitable for bulk downloads.
+       */
+      raw_block_range get_raw_blocks( uint32_t block_num_from, const optional<uint32_t>& limit = optional<uint32_t>() )const;
+
       /**
        * @brief used to fetch an individual transaction.
        * @param block_num height of the block to fetch
@@ -239,6 +266,13 @@ class database_api
        */
       object_id_type get_next_object_id( uint8_t space_id, uint8_t type_id, bool with_pending_transactions )const;
 
+      /**
+       * @brief Get the memory usage of the pools which hold the objects of the most frequently changed indexes
+       *        and the copies kept for undo
+       * @return the statistics of all object pools of the node, ordered by name
+       */
+      vector<graphene::db::object_pool_statistics> get_object_pool_statistics()const;
+
       //////////
       // Keys //
       //////////
@@ -580,6 +614,15 @@ class database_api
        */
       vector<collateral_bid_object> get_collateral_bids(const std::string& a, uint32_t limit, uint32_t start)const;
 
+      /**
+       * @brief Get price feeds published for a given asset
+       * @param a symbol name or ID of the market-issued asset
+       * @return The price feeds of the asset, ordered by publisher ID
+       *
+       * Note: the number of feeds is limited by the @a maximum_asset_feed_publishers chain parameter
+       */
+      vector<asset_bitasset_feed_object> get_price_feeds(const std::string& a)const;
+
       /**
        * @brief Get open margin positions of a given account
        * @param account_name_or_id name or ID of an account
@@ -1468,6 +1511,7 @@ extern template class fc::api<graphene::app::database_api>;
 FC_API(graphene::app::database_api,
    // Objects
    (get_objects)
+   (get_raw_objects)
 
    // Subscriptions
    (set_subscribe_callback)
@@ -1480,6 +1524,7 @@ FC_API(graphene::app::database_api,
    (get_block_header)
    (get_block_header_batch)
    (get_block)
+   (get_raw_blocks)
    (get_transaction)
    (get_recent_transaction_by_id)
 
@@ -1490,6 +1535,7 @@ FC_API(graphene::app::database_api,
    (get_chain_id)
    (get_dynamic_global_properties)
    (get_next_object_id)
+   (get_object_pool_statistics)
 
    // Keys
    (get_key_references)
@@ -1532,6 +1578,7 @@ FC_API(graphene::app::database_api,
    (get_settle_orders_by_account)
    (get_margin_positions)
    (get_collateral_bids)
+   (get_price_feeds)
    (subscribe_to_market)
    (unsubscribe_from_market)
    (get_ticker)
@@ -301,6 +301,9 @@ void_result account_update_evaluator::do_apply( const account_update_operation&
    }
 
    // update account object
+   modified_fields_type changed_fields = account_object::other_fields;
+   if( o.owner || o.active || ( o.new_options && o.new_options->memo_key != acnt->options.memo_key ) )
+      changed_fields |= account_object::authority_fields;
    d.modify( *acnt, [&o](account_object& a){
       if( o.owner )
       {
@@ -327,7 +330,7 @@ void_result account_update_evaluator::do_apply( const account_update_operation&
          a.active_special_authority = *(o.extensions.value.active_special_authority);
          a.top_n_control_flags = 0;
       }
-   });
+   }, changed_fields);
 
    bool sa_after = acnt->has_special_authority();
 
@@ -374,7 +377,7 @@ void_result account_whitelist_evaluator::do_apply(const account_whitelist_operat
          a.blacklisting_accounts.insert(o.authorizing_account);
       else
          a.blacklisting_accounts.erase(o.authorizing_account);
-   });
+   }, account_object::other_fields);
 
    /** for tracking purposes only, this state is not needed to evaluate */
    d.modify( o.authorizing_account(d), [&]( account_object& a ) {
@@ -387,7 +390,7 @@ void_result account_whitelist_evaluator::do_apply(const account_whitelist_operat
         a.blacklisted_accounts.insert( o.account_to_list );
      else
         a.blacklisted_accounts.erase( o.account_to_list );
-   });
+   }, account_object::other_fields);
 
    return void_result();
 } FC_CAPTURE_AND_RETHROW( (o) ) }
@@ -429,7 +432,7 @@ void_result account_upgrade_evaluator::do_apply(const account_upgrade_evaluator:
          a.referrer = a.get_id();
          a.membership_expiration_date = d.head_block_time() + fc::days(365);
       }
-   });
+   }, account_object::other_fields);
 
    return {};
 } FC_RETHROW_EXCEPTIONS( error, "Unable to upgrade account '${a}'", ("a",o.account_to_upgrade(db()).name) ) }
@@ -61,7 +61,7 @@ void account_statistics_object::process_fees(const account_object& a, database&
          if( account.referrer(d).is_basic_account(d.head_block_time()) )
             d.modify( account, [](account_object& acc) {
                acc.referrer = acc.lifetime_referrer;
-            });
+            }, account_object::other_fields );
 
          share_type network_cut = cut_fee(core_fee_total, account.network_fee_percentage);
          assert( network_cut <= core_fee_total );
@@ -142,15 +142,15 @@ void account_member_index::object_inserted(const object& obj)
 
     auto account_members = get_account_members(a);
     for( auto item : account_members )
-       account_to_account_memberships[item].insert(account_id);
+       account_to_account_memberships.insert(item, account_id);
 
     auto key_members = get_key_members(a);
     for( auto item : key_members )
-       account_to_key_memberships[item].insert(account_id);
+       account_to_key_memberships.insert(item, account_id);
 
     auto address_members = get_address_members(a);
     for( auto item : address_members )
-       account_to_address_memberships[item].insert(account_id);
+       account_to_address_memberships.insert(item, account_id);
 }
 
 void account_member_index::object_removed(const object& obj)
@@ -161,15 +161,15 @@ void account_member_index::object_removed(const object& obj)
 
     auto key_members = get_key_members(a);
     for( auto item : key_members )
-       account_to_key_memberships[item].erase( account_id );
+       account_to_key_memberships.erase( item, account_id );
 
     auto address_members = get_address_members(a);
     for( auto item : address_members )
-       account_to_address_memberships[item].erase( account_id );
+       account_to_address_memberships.erase( item, account_id );
 
     auto account_members = get_account_members(a);
     for( auto item : account_members )
-       account_to_account_memberships[item].erase( account_id );
+       account_to_account_memberships.erase( item, account_id );
 }
 
 void account_member_index::about_to_modify(const object& before)
@@ -198,7 +198,7 @@ void account_member_index::object_modified(const object& after)
                            std::inserter(removed, removed.end()));
 
        for( auto itr = removed.begin(); itr != removed.end(); ++itr )
-          account_to_account_memberships[*itr].erase(account_id);
+          account_to_account_memberships.erase(*itr, account_id);
 
        vector<account_id_type> added;
        added.reserve(after_account_members.size());
@@ -207,7 +207,7 @@ void account_member_index::object_modified(const object& after)
                            std::inserter(added, added.end()));
 
        for( auto itr = added.begin(); itr != added.end(); ++itr )
-          account_to_account_memberships[*itr].insert(account_id);
+          account_to_account_memberships.insert(*itr, account_id);
     }
 
 
@@ -221,7 +221,7 @@ void account_member_index::object_modified(const object& after)
                            std::inserter(removed, removed.end()));
 
        for( auto itr = removed.begin(); itr != removed.end(); ++itr )
-          account_to_key_memberships[*itr].erase(account_id);
+          account_to_key_memberships.erase(*itr, account_id);
 
        vector<public_key_type> added;
        added.reserve(after_key_members.size());
@@ -230,7 +230,7 @@ void account_member_index::object_modified(const object& after)
                            std::inserter(added, added.end()));
 
        for( auto itr = added.begin(); itr != added.end(); ++itr )
-          account_to_key_memberships[*itr].insert(account_id);
+          account_to_key_memberships.insert(*itr, account_id);
     }
 
     {
@@ -243,7 +243,7 @@ void account_member_index::object_modified(const object& after)
                            std::inserter(removed, removed.end()));
 
        for( auto itr = removed.begin(); itr != removed.end(); ++itr )
-          account_to_address_memberships[*itr].erase(account_id);
+          account_to_address_memberships.erase(*itr, account_id);
 
        vector<address> added;
        added.reserve(after_address_members.size());
@@ -252,7 +252,7 @@ void account_member_index::object_modified(const object& after)
                            std::inserter(added, added.end()));
 
        for( auto itr = added.begin(); itr != added.end(); ++itr )
-          account_to_address_memberships[*itr].insert(account_id);
+          account_to_address_memberships.insert(*itr, account_id);
     }
 
 }
@@ -290,9 +290,10 @@ void balances_by_account_index::object_modified( const object& after  )
    ids_being_modified.pop();
 }
 
-const map< asset_id_type, const account_balance_object* >& balances_by_account_index::get_account_balances( const account_id_type& acct )const
+const balances_by_account_index::account_balance_map& balances_by_account_index::get_account_balances(
+      const account_id_type& acct )const
 {
-   static const map< asset_id_type, const account_balance_object* > _empty;
+   static const account_balance_map _empty;
 
    if( balances.size() < (acct.instance.value >> bits) + 1 ) return _empty;
    return balances[acct.instance.value >> bits][acct.instance.value & mask];
@@ -981,18 +981,25 @@ static bool update_bitasset_object_options(
    // are we modifying the underlying? If so, reset the feeds
    if( backing_asset_changed )
    {
-      if( is_witness_or_committee_fed )
+      const auto& feed_idx = db.get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>();
+      auto itr = feed_idx.lower_bound( std::make_tuple( bdo.asset_id ) );
+      while( itr != feed_idx.end() && itr->asset_id == bdo.asset_id )
       {
-         bdo.feeds.clear();
-      }
-      else
-      {
-         // for non-witness-feeding and non-committee-feeding assets, modify all feeds
-         // published by producers to nothing, since we can't simply remove them. For more information:
-         // https://github.com/bitshares/bitshares-core/pull/832#issuecomment-384112633
-         for( auto& current_feed : bdo.feeds )
+         const asset_bitasset_feed_object& feed_obj = *itr;
+         ++itr;
+         if( is_witness_or_committee_fed )
          {
-            current_feed.second.second.settlement_price = price();
+            db.remove( feed_obj );
+         }
+         else
+         {
+            // for non-witness-feeding and non-committee-feeding assets, modify all feeds
+            // published by producers to nothing, since we can't simply remove them. For more information:
+            // https://github.com/bitshares/bitshares-core/pull/832#issuecomment-384112633
+            db.modify( feed_obj, []( asset_bitasset_feed_object& f )
+            {
+               f.feed.settlement_price = price();
+            });
          }
       }
    }
@@ -1073,31 +1080,39 @@ void_result asset_update_feed_producers_evaluator::do_apply(const asset_update_f
 { try {
    database& d = db();
    const asset_bitasset_data_object& bitasset_to_update = asset_to_update->bitasset_data(d);
-   d.modify( bitasset_to_update, [&o](asset_bitasset_data_object& a) {
-      //This is tricky because I have a set of publishers coming in, but a map of publisher to feed is stored.
-      //I need to update the map such that the keys match the new publishers, but not munge the old price feeds from
-      //publishers who are being kept.
-
-      // TODO possible performance optimization:
-      //      Since both the map and the set are ordered by account already, we can iterate through them only once
-      //      and avoid lookups while iterating by maintaining two iterators at same time.
-      //      However, this operation is not used much, and both the set and the map are small,
-      //      so likely we won't gain much with the optimization.
-
-      //First, remove any old publishers who are no longer publishers
-      for( auto itr = a.feeds.begin(); itr != a.feeds.end(); )
-      {
-         if( o.new_feed_producers.count(itr->first) == 0 )
-            itr = a.feeds.erase(itr);
-         else
-            ++itr;
-      }
-      //Now, add any new publishers
-      for( const account_id_type& acc : o.new_feed_producers )
+   //This is tricky because I have a set of publishers coming in, but a feed object per publisher is stored.
+   //I need to update the feeds such that the publishers match the new set, but not munge the old price feeds from
+   //publishers who are being kept.
+   //Both the feed index and the set are ordered by account, so walk them together.
+   const auto& feed_idx = d.get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>();
+   auto feed_itr = feed_idx.lower_bound( std::make_tuple( o.asset_to_update ) );
+   auto producer_itr = o.new_feed_producers.begin();
+   while( feed_itr != feed_idx.end() && feed_itr->asset_id == o.asset_to_update )
+   {
+      const asset_bitasset_feed_object& feed_obj = *feed_itr;
+      ++feed_itr;
+      //Add any new publishers ordered before this one
+      for( ; producer_itr != o.new_feed_producers.end() && *producer_itr < feed_obj.publisher; ++producer_itr )
       {
-         a.feeds[acc];
+         d.create<asset_bitasset_feed_object>( [&o,&producer_itr]( asset_bitasset_feed_object& f ) {
+            f.asset_id = o.asset_to_update;
+            f.publisher = *producer_itr;
+         });
       }
-   });
+      //Keep the publisher if it is still in the set, otherwise remove it
+      if( producer_itr != o.new_feed_producers.end() && *producer_itr == feed_obj.publisher )
+         ++producer_itr;
+      else
+         d.remove( feed_obj );
+   }
+   //Now, add the remaining new publishers
+   for( ; producer_itr != o.new_feed_producers.end(); ++producer_itr )
+   {
+      d.create<asset_bitasset_feed_object>( [&o,&producer_itr]( asset_bitasset_feed_object& f ) {
+         f.asset_id = o.asset_to_update;
+         f.publisher = *producer_itr;
+      });
+   }
    d.update_bitasset_current_feed( bitasset_to_update );
    // Note: we don't try to revive the bitasset here if it was GSed // TODO probably we should do it
 
@@ -1418,7 +1433,8 @@ void_result asset_publish_feeds_evaluator::do_evaluate(const asset_publish_feed_
    }
    else
    {
-      FC_ASSERT( bitasset.feeds.count(o.publisher) > 0,
+      const auto& feed_idx = d.get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>();
+      FC_ASSERT( feed_idx.find( std::make_tuple( o.asset_id, o.publisher ) ) != feed_idx.end(),
                  "The account is not in the set of allowed price feed producers of this asset" );
    }
 
@@ -1441,10 +1457,22 @@ void_result asset_publish_feeds_evaluator::do_apply(const asset_publish_feed_ope
    auto old_feed = bad.current_feed;
    auto old_median_feed = bad.median_feed;
    // Store medians for this asset
-   d.modify( bad , [&o,&head_time](asset_bitasset_data_object& a) {
-      a.feeds[o.publisher] = make_pair( head_time, price_feed_with_icr( o.feed,
-                                                      o.extensions.value.initial_collateral_ratio ) );
-   });
+   const auto& feed_idx = d.get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>();
+   auto feed_itr = feed_idx.find( std::make_tuple( o.asset_id, o.publisher ) );
+   const auto& update_feed = [&o,&head_time]( asset_bitasset_feed_object& f ) {
+      f.publication_time = head_time;
+      f.feed = price_feed_with_icr( o.feed, o.extensions.value.initial_collateral_ratio );
+   };
+   if( feed_itr == feed_idx.end() )
+   {
+      d.create<asset_bitasset_feed_object>( [&o,&update_feed]( asset_bitasset_feed_object& f ) {
+         f.asset_id = o.asset_id;
+         f.publisher = o.publisher;
+         update_feed( f );
+      });
+   }
+   else
+      d.modify( *feed_itr, update_feed );
    d.update_bitasset_current_feed( bad );
 
    bool after_core_hardfork_2582 = HARDFORK_CORE_2582_PASSED( head_time ); // Price feed issues
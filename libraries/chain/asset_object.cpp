@@ -45,19 +45,24 @@ share_type asset_bitasset_data_object::max_force_settlement_volume(share_type cu
 }
 
 void asset_bitasset_data_object::update_median_feeds( time_point_sec current_time,
-                                                      time_point_sec next_maintenance_time )
+                                                      time_point_sec next_maintenance_time,
+                                                      const asset_bitasset_feeds_by_asset_publisher& feeds )
 {
    bool after_core_hardfork_1270 = ( next_maintenance_time > HARDFORK_CORE_1270_TIME ); // call price caching issue
    current_feed_publication_time = current_time;
    vector<std::reference_wrapper<const price_feed_with_icr>> effective_feeds;
-   // find feeds that were alive at current_time
-   for( const pair<account_id_type, pair<time_point_sec,price_feed_with_icr>>& f : feeds )
+   // find feeds that were alive at current_time.
+   // Note: they are ordered by publisher, which affects the result of nth_element() below when some values are
+   //       equivalent but not equal, E.G. prices 1/2 and 2/4, so the order must not be changed
+   const auto range = feeds.equal_range( std::make_tuple( asset_id ) );
+   for( auto itr = range.first; itr != range.second; ++itr )
    {
-      if( (current_time - f.second.first).to_seconds() < options.feed_lifetime_sec &&
-          f.second.first != time_point_sec() )
+      const asset_bitasset_feed_object& f = *itr;
+      if( (current_time - f.publication_time).to_seconds() < options.feed_lifetime_sec &&
+          f.publication_time != time_point_sec() )
       {
-         effective_feeds.emplace_back(f.second.second);
-         current_feed_publication_time = std::min(current_feed_publication_time, f.second.first);
+         effective_feeds.emplace_back(f.feed);
+         current_feed_publication_time = std::min(current_feed_publication_time, f.publication_time);
       }
    }
 
@@ -226,7 +231,6 @@ FC_REFLECT_DERIVED_NO_TYPENAME( graphene::chain::asset_dynamic_data_object, (gra
 
 FC_REFLECT_DERIVED_NO_TYPENAME( graphene::chain::asset_bitasset_data_object, (graphene::db::object),
                     (asset_id)
-                    (feeds)
                     (median_feed)
                     (current_feed)
                     (current_feed_publication_time)
@@ -243,8 +247,12 @@ FC_REFLECT_DERIVED_NO_TYPENAME( graphene::chain::asset_bitasset_data_object, (gr
                     (feed_cer_updated)
                   )
 
+FC_REFLECT_DERIVED_NO_TYPENAME( graphene::chain::asset_bitasset_feed_object, (graphene::db::object),
+                    (asset_id)(publisher)(publication_time)(feed) )
+
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::chain::price_feed_with_icr )
 
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::chain::asset_object )
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::chain::asset_bitasset_data_object )
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::chain::asset_dynamic_data_object )
+GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::chain::asset_bitasset_feed_object )
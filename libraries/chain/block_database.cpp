@@ -79,7 +79,17 @@ void block_database::flush()
   _block_num_to_pos.flush();
 }
 
-void block_database::store( const block_id_type& _id, const signed_block& b )
+void block_database::store( const block_id_type& id, const signed_block& b )
+{
+   store_packed( id, b, fc::raw::pack( b ) );
+}
+
+void block_database::store( const block_id_type& id, const precomputable_block& b )
+{
+   store_packed( id, b, b.get_packed() );
+}
+
+void block_database::store_packed( const block_id_type& _id, const signed_block& b, const vector<char>& vec )
 {
    block_id_type id = _id;
    if( id == block_id_type() )
@@ -90,7 +100,6 @@ void block_database::store( const block_id_type& _id, const signed_block& b )
    _block_num_to_pos.seekp( sizeof( index_entry ) * int64_t(block_header::num_from_id(id)) );
    index_entry e;
    _blocks.seekp( 0, _blocks.end );
-   auto vec = fc::raw::pack( b );
    e.block_pos  = _blocks.tellp();
    e.block_size = vec.size();
    e.block_id   = id;
@@ -210,6 +219,35 @@ optional<signed_block> block_database::fetch_by_number( uint32_t block_num )cons
    return optional<signed_block>();
 }
 
+optional<vector<char>> block_database::fetch_packed_by_number( uint32_t block_num )const
+{
+   try
+   {
+      index_entry e;
+      int64_t index_pos = sizeof(e) * int64_t(block_num);
+      _block_num_to_pos.seekg( 0, _block_num_to_pos.end );
+      if ( _block_num_to_pos.tellg() <= index_pos )
+         return {};
+
+      _block_num_to_pos.seekg( index_pos, _block_num_to_pos.beg );
+      _block_num_to_pos.read( (char*)&e, sizeof(e) );
+      if( e.block_size.value() == 0 )
+         return {};
+
+      vector<char> data( e.block_size.value() );
+      _blocks.seekg( e.block_pos.value() );
+      _blocks.read( data.data(), e.block_size.value() );
+      return data;
+   }
+   catch (const fc::exception&)
+   {
+   }
+   catch (const std::exception&)
+   {
+   }
+   return optional<vector<char>>();
+}
+
 optional<index_entry> block_database::last_index_entry()const {
    try
    {
@@ -142,7 +142,9 @@ void_result custom_authority_update_evaluator::do_evaluate(const custom_authorit
    FC_ASSERT(restriction_count <= config->max_custom_authority_restrictions,
              "Cannot update custom authority: updated authority would exceed the maximum number of restrictions");
 
-   get_restriction_predicate(op.restrictions_to_add, old_object->operation_type);
+   // Validate the restrictions by compiling them. The same operation is evaluated when it is pushed and when
+   // it is applied in a block, so take the predicate from the registry to compile it only once.
+   restriction_predicate_registry::instance().get(op.restrictions_to_add, old_object->operation_type);
    return void_result();
 } FC_CAPTURE_AND_RETHROW((op)) }
 
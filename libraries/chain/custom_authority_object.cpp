@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <graphene/chain/custom_authority_object.hpp>
+
+#include <fc/io/raw.hpp>
+
+namespace graphene { namespace chain {
+
+constexpr size_t restriction_predicate_registry::default_capacity;
+
+restriction_predicate_registry& restriction_predicate_registry::instance()
+{
+   static restriction_predicate_registry registry;
+   return registry;
+}
+
+digest_type restriction_predicate_registry::get_key( const vector<restriction>& rs, const unsigned_int& op_type )
+{
+   digest_type::encoder enc;
+   fc::raw::pack( enc, op_type );
+   fc::raw::pack( enc, rs );
+   return enc.result();
+}
+
+restriction_predicate_function restriction_predicate_registry::get( const vector<restriction>& rs,
+                                                                    const unsigned_int& op_type )
+{
+   const digest_type key = get_key( rs, op_type );
+   {
+      std::lock_guard<std::mutex> guard( _mutex );
+      auto itr = _predicates.find( key );
+      if( itr != _predicates.end() )
+      {
+         _lru.splice( _lru.begin(), _lru, itr->second.lru_position );
+         return itr->second.predicate;
+      }
+   }
+
+   // Compile without holding the lock, so that different predicates can be compiled in parallel.
+   // If another thread has compiled the same predicate meanwhile, its result is kept.
+   auto predicate = get_restriction_predicate( rs, op_type );
+
+   std::lock_guard<std::mutex> guard( _mutex );
+   auto itr = _predicates.find( key );
+   if( itr != _predicates.end() )
+   {
+      _lru.splice( _lru.begin(), _lru, itr->second.lru_position );
+      return itr->second.predicate;
+   }
+   _lru.push_front( key );
+   itr = _predicates.emplace( key, entry{ std::move(predicate), _lru.begin() } ).first;
+   // Copy the predicate before evicting, the capacity may be 0
+   restriction_predicate_function result = itr->second.predicate;
+   evict();
+   return result;
+}
+
+void restriction_predicate_registry::evict()
+{
+   while( _predicates.size() > _capacity )
+   {
+      _predicates.erase( _lru.back() );
+      _lru.pop_back();
+   }
+}
+
+size_t restriction_predicate_registry::size()const
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   return _predicates.size();
+}
+
+size_t restriction_predicate_registry::get_capacity()const
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   return _capacity;
+}
+
+void restriction_predicate_registry::set_capacity( size_t capacity )
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   _capacity = capacity;
+   evict();
+}
+
+} } // graphene::chain
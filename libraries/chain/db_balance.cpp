@@ -34,8 +34,7 @@ namespace graphene { namespace chain {
 
 asset database::get_balance(account_id_type owner, asset_id_type asset_id) const
 {
-   auto& index = get_index_type< primary_index< account_balance_index > >().get_secondary_index<balances_by_account_index>();
-   auto abo = index.get_account_balance( owner, asset_id );
+   auto abo = _p_balances_by_account->get_account_balance( owner, asset_id );
    if( !abo )
       return asset(0, asset_id);
    return abo->get_balance();
@@ -56,8 +55,7 @@ void database::adjust_balance(account_id_type account, asset delta )
    if( delta.amount == 0 )
       return;
 
-   auto& index = get_index_type< primary_index< account_balance_index > >().get_secondary_index<balances_by_account_index>();
-   auto abo = index.get_account_balance( account, delta.asset_id );
+   auto abo = _p_balances_by_account->get_account_balance( account, delta.asset_id );
    if( !abo )
    {
       FC_ASSERT( delta.amount > 0, "Insufficient Balance: ${a}'s balance of ${b} is less than required ${r}",
@@ -77,7 +75,7 @@ void database::adjust_balance(account_id_type account, asset delta )
                     ("a",account(*this).name)("b",to_pretty_string(abo->get_balance()))("r",to_pretty_string(-delta)));
       modify(*abo, [delta](account_balance_object& b) {
          b.adjust_balance(delta);
-      });
+      }, account_balance_object::balance_fields);
    }
 
 } FC_CAPTURE_AND_RETHROW( (account)(delta) ) }
@@ -236,7 +234,7 @@ void database::deposit_cashback(const account_object& acct, share_type amount, b
       modify( acct, [&new_vbid]( account_object& _acct )
       {
          _acct.cashback_vb = *new_vbid;
-      } );
+      }, account_object::other_fields );
       modify( acct.statistics( *this ), []( account_statistics_object& aso )
       {
          aso.has_cashback_vb = true;
@@ -45,6 +45,36 @@
 
 namespace graphene { namespace chain {
 
+/**
+ * Holds _read_write_mutex exclusively while the database is being modified.
+ *
+ * All modifications are made by the same thread, but possibly by different fibers, E.G. a transaction being pushed
+ * while a block is being applied, so the mutex is only locked by the outermost guard.
+ */
+class write_lock_guard {
+public:
+   write_lock_guard( read_write_mutex& mutex, uint32_t& nesting_counter )
+      : _mutex(mutex), _counter(nesting_counter)
+   {
+      if( 0 == _counter )
+         _mutex.lock();
+      ++_counter;
+   }
+   ~write_lock_guard()
+   {
+      if( 0 == --_counter )
+         _mutex.unlock();
+   }
+private:
+   read_write_mutex& _mutex;
+   uint32_t& _counter;
+};
+
+std::shared_lock<read_write_mutex> database::read_lock()const
+{
+   return std::shared_lock<read_write_mutex>( _read_write_mutex );
+}
+
 bool database::is_known_block( const block_id_type& id )const
 {
    return _fork_db.is_known_block(id) || _block_id_to_block.contains(id);
@@ -82,12 +112,21 @@ optional<signed_block> database::fetch_block_by_number( uint32_t num )const
       return _block_id_to_block.fetch_by_number(num);
 }
 
-const signed_transaction& database::get_recent_transaction(const transaction_id_type& trx_id) const
+optional<vector<char>> database::fetch_packed_block_by_number( uint32_t num )const
+{
+   auto results = _fork_db.fetch_block_by_number(num);
+   if( results.size() == 1 )
+      return results[0]->data.get_packed();
+   else
+      return _block_id_to_block.fetch_packed_by_number(num);
+}
+
+signed_transaction database::get_recent_transaction(const transaction_id_type& trx_id) const
 {
-   auto& index = get_index_type<transaction_index>().indices().get<by_trx_id>();
-   auto itr = index.find(trx_id);
-   FC_ASSERT(itr != index.end());
-   return itr->trx;
+   FC_ASSERT( is_known_transaction( trx_id ) );
+   auto trx = _recent_transactions.find( trx_id );
+   FC_ASSERT( trx.valid(), "Transaction ${id} is no longer cached", ("id",trx_id) );
+   return *trx;
 }
 
 std::vector<block_id_type> database::get_block_ids_on_fork(block_id_type head_of_fork) const
@@ -116,21 +155,28 @@ std::vector<block_id_type> database::get_block_ids_on_fork(block_id_type head_of
  */
 bool database::push_block(const signed_block& new_block, uint32_t skip)
 {
-//   idump((new_block.block_num())(new_block.id())(new_block.timestamp)(new_block.previous));
+   return push_block( std::make_shared<const precomputable_block>( new_block ), skip );
+}
+
+bool database::push_block(const precomputable_block_ptr& new_block_ptr, uint32_t skip)
+{
+//   idump((new_block_ptr->block_num())(new_block_ptr->id())(new_block_ptr->timestamp)(new_block_ptr->previous));
+   write_lock_guard guard( _read_write_mutex, _write_nesting_depth );
    bool result;
    detail::with_skip_flags( *this, skip, [&]()
    {
       detail::without_pending_transactions( *this, std::move(_pending_tx),
       [&]()
       {
-         result = _push_block(new_block);
+         result = _push_block(new_block_ptr);
       });
    });
    return result;
 }
 
-bool database::_push_block(const signed_block& new_block)
+bool database::_push_block(const precomputable_block_ptr& new_block_ptr)
 { try {
+   const precomputable_block& new_block = *new_block_ptr;
    uint32_t skip = get_node_properties().skip_flags;
 
    const auto now = fc::time_point::now().sec_since_epoch();
@@ -143,7 +189,7 @@ bool database::_push_block(const signed_block& new_block)
          verify_signing_witness( new_block, *prev_block );
    }
 
-   const shared_ptr<fork_item> new_head = _fork_db.push_block(new_block);
+   const shared_ptr<fork_item> new_head = _fork_db.push_block(new_block_ptr);
    //If the head block from the longest chain does not build off of the current head, we need to switch forks.
    if( new_head->data.previous != head_block_id() )
    {
@@ -225,7 +271,7 @@ bool database::_push_block(const signed_block& new_block)
    }
 
    return false;
-} FC_CAPTURE_AND_RETHROW( (new_block) ) }
+} FC_CAPTURE_AND_RETHROW( (new_block_ptr) ) }
 
 void database::verify_signing_witness( const signed_block& new_block, const fork_item& fork_entry )const
 {
@@ -269,6 +315,7 @@ processed_transaction database::push_transaction( const precomputable_transactio
 { try {
    // see https://github.com/bitshares/bitshares-core/issues/1573
    FC_ASSERT( fc::raw::pack_size( trx ) < (1024 * 1024), "Transaction exceeds maximum transaction size." );
+   write_lock_guard guard( _read_write_mutex, _write_nesting_depth );
    processed_transaction result;
    detail::with_skip_flags( *this, skip, [&]()
    {
@@ -304,6 +351,7 @@ processed_transaction database::_push_transaction( const precomputable_transacti
 
 processed_transaction database::validate_transaction( const signed_transaction& trx )
 {
+   write_lock_guard guard( _read_write_mutex, _write_nesting_depth );
    auto session = _undo_db.start_undo_session();
    return _apply_transaction( trx );
 }
@@ -377,6 +425,7 @@ signed_block database::generate_block(
    uint32_t skip /* = 0 */
    )
 { try {
+   write_lock_guard guard( _read_write_mutex, _write_nesting_depth );
    signed_block result;
    detail::with_skip_flags( *this, skip, [&]()
    {
@@ -511,6 +560,7 @@ signed_block database::_generate_block(
  */
 void database::pop_block()
 { try {
+   write_lock_guard guard( _read_write_mutex, _write_nesting_depth );
    _pending_tx_session.reset();
    auto fork_db_head = _fork_db.head();
    FC_ASSERT( fork_db_head, "Trying to pop() from empty fork database!?" );
@@ -527,6 +577,7 @@ void database::pop_block()
 
 void database::clear_pending()
 { try {
+   write_lock_guard guard( _read_write_mutex, _write_nesting_depth );
    assert( (_pending_tx.size() == 0) || _pending_tx_session.valid() );
    _pending_tx.clear();
    _pending_tx_session.reset();
@@ -620,6 +671,12 @@ void database::_apply_block( const signed_block& next_block )
        * entire block fails to apply.  We only need an "undo" state
        * for transactions when validating broadcast transactions or
        * when building a block.
+       *
+       * The transactions are applied one after another. Object IDs are allocated sequentially, starting with
+       * the transaction_history_object created for every transaction, so the IDs and thereby the resulting
+       * state depend on the order of execution. The undo database also records changes in place and is not
+       * thread-safe. The state-independent work (validation, IDs, sizes and signature recovery) is done in
+       * parallel in precompute_parallel() before the block is applied.
        */
       trx.operation_results = apply_transaction( trx, skip ).operation_results;
       ++_current_trx_in_block;
@@ -640,6 +697,8 @@ void database::_apply_block( const signed_block& next_block )
       perform_chain_maintenance( next_block );
 
    create_block_summary(next_block);
+   // Each of these steps finds its due objects at the head of an index ordered by deadline,
+   // so the cost of a block without expirations does not depend on the number of pending objects
    clear_expired_transactions();
    clear_expired_proposals();
    clear_expired_orders();
@@ -668,11 +727,11 @@ void database::_apply_block( const signed_block& next_block )
 } FC_CAPTURE_AND_RETHROW( (next_block.block_num()) )  }
 
 /**
- * @note if a @c processed_transaction is passed in, it is cast into @c signed_transaction here.
+ * @note if a @c processed_transaction is passed in, it is cast into @c precomputable_transaction here.
  *       It also means that the @c operation_results field is ignored by consensus, although it
  *       is a part of block data.
  */
-processed_transaction database::apply_transaction(const signed_transaction& trx, uint32_t skip)
+processed_transaction database::apply_transaction(const precomputable_transaction& trx, uint32_t skip)
 {
    processed_transaction result;
    detail::with_skip_flags( *this, skip, [&]()
@@ -682,7 +741,7 @@ processed_transaction database::apply_transaction(const signed_transaction& trx,
    return result;
 }
 
-processed_transaction database::_apply_transaction(const signed_transaction& trx)
+processed_transaction database::_apply_transaction(const precomputable_transaction& trx)
 { try {
    uint32_t skip = get_node_properties().skip_flags;
 
@@ -743,7 +802,7 @@ processed_transaction database::_apply_transaction(const signed_transaction& trx
    {
       create<transaction_history_object>([&trx](transaction_history_object& transaction) {
          transaction.trx_id = trx.id();
-         transaction.trx = trx;
+         transaction.expiration = trx.expiration;
       });
    }
 
@@ -765,6 +824,9 @@ processed_transaction database::_apply_transaction(const signed_transaction& trx
    FC_ASSERT( samet_fund_idx.empty() || samet_fund_idx.begin()->unpaid_amount == 0,
               "Unpaid SameT Fund debt detected" );
 
+   if( 0 == (skip & skip_transaction_dupe_check) )
+      _recent_transactions.add( trx.id(), trx );
+
    return ptrx;
 } FC_CAPTURE_AND_RETHROW( (trx) ) }
 
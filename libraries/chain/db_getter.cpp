@@ -158,6 +158,19 @@ const limit_order_object* database::find_settled_debt_order( const asset_id_type
    return nullptr;
 }
 
+flat_map<account_id_type, pair<time_point_sec,price_feed_with_icr>> database::get_bitasset_feeds(
+      const asset_bitasset_data_object& bitasset )const
+{
+   flat_map<account_id_type, pair<time_point_sec,price_feed_with_icr>> result;
+   const auto& feed_idx = get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>();
+   const auto range = feed_idx.equal_range( std::make_tuple( bitasset.asset_id ) );
+   // The index is ordered by publisher
+   result.reserve( std::distance( range.first, range.second ) );
+   for( auto itr = range.first; itr != range.second; ++itr )
+      result.emplace_hint( result.end(), itr->publisher, std::make_pair( itr->publication_time, itr->feed ) );
+   return result;
+}
+
 const call_order_object* database::find_least_collateralized_short( const asset_bitasset_data_object& bitasset,
                                                                     bool force_by_collateral_index )const
 {
@@ -180,7 +180,7 @@ void database::initialize_indexes()
    add_index< primary_index<transaction_index                             > >();
 
    auto bal_idx = add_index< primary_index<account_balance_index          > >();
-   bal_idx->add_secondary_index<balances_by_account_index>();
+   _p_balances_by_account = bal_idx->add_secondary_index<balances_by_account_index>();
 
    add_index< primary_index<asset_bitasset_data_index,                 13 > >(); // 8192
    add_index< primary_index<simple_index<global_property_object          >> >();
@@ -196,6 +196,7 @@ void database::initialize_indexes()
    add_index< primary_index<collateral_bid_index                          > >();
    add_index< primary_index< simple_index< fba_accumulator_object       > > >();
    add_index< primary_index<credit_deal_summary_index                     > >();
+   add_index< primary_index<asset_bitasset_feed_index                     > >();
 }
 
 } }
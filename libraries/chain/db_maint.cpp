@@ -91,7 +91,7 @@ void database::perform_account_maintenance(Type tally_helper)
 
          modify( bal_obj, []( account_balance_object& abo ) {
             abo.maintenance_flag = false;
-         });
+         }, account_balance_object::balance_fields );
 
          bal_itr = bal_idx.rbegin();
       }
@@ -737,9 +737,14 @@ void create_buyback_orders( database& db )
          continue;
       }
 
+      // The orders below may create the balance object of the asset to buy, which is inserted into the map of
+      // balances of the account, so iterate over a copy
+      vector< const account_balance_object* > balances;
       for( const auto& entry : bal_idx.get_account_balances( buyback_account.get_id() ) )
+         balances.push_back( entry.second );
+
+      for( const auto* it : balances )
       {
-         const auto* it = entry.second;
          asset_id_type asset_to_sell = it->asset_type;
          share_type amount_to_sell = it->balance;
          if( asset_to_sell == asset_to_buy.id )
@@ -956,34 +961,31 @@ void database::process_bitassets()
    uint32_t head_epoch_seconds = head_time.sec_since_epoch();
    bool after_hf_core_518 = ( head_time >= HARDFORK_CORE_518_TIME ); // clear expired feeds
 
-   const auto& update_bitasset = [this,&head_time,head_epoch_seconds,after_hf_core_518]
-                                 ( asset_bitasset_data_object &o )
+   const auto& feed_idx = get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>();
+
+   for( const auto& d : get_index_type<asset_bitasset_data_index>().indices() )
    {
-      o.force_settled_volume = 0; // Reset all BitAsset force settlement volumes to zero
+      // Reset all BitAsset force settlement volumes to zero
+      modify( d, []( asset_bitasset_data_object& o ) { o.force_settled_volume = 0; } );
 
       // clear expired feeds if smartcoin (witness_fed or committee_fed) && check overflow
-      if( after_hf_core_518 && o.options.feed_lifetime_sec < head_epoch_seconds
-            && ( 0 != ( o.asset_id(*this).options.flags & ( witness_fed_asset | committee_fed_asset ) ) ) )
+      if( after_hf_core_518 && d.options.feed_lifetime_sec < head_epoch_seconds
+            && ( 0 != ( d.asset_id(*this).options.flags & ( witness_fed_asset | committee_fed_asset ) ) ) )
       {
-         fc::time_point_sec calculated = head_time - o.options.feed_lifetime_sec;
-         auto itr = o.feeds.rbegin();
-         auto end = o.feeds.rend();
-         while( itr != end ) // loop feeds
+         fc::time_point_sec calculated = head_time - d.options.feed_lifetime_sec;
+         auto itr = feed_idx.lower_bound( std::make_tuple( d.asset_id ) );
+         while( itr != feed_idx.end() && itr->asset_id == d.asset_id ) // loop feeds
          {
-            auto feed_time = itr->second.first;
-            std::advance( itr, 1 );
-            if( feed_time < calculated )
-               o.feeds.erase( itr.base() ); // delete expired feed
+            const asset_bitasset_feed_object& feed_obj = *itr;
+            ++itr;
+            if( feed_obj.publication_time < calculated )
+               remove( feed_obj ); // delete expired feed
          }
          // Note: we don't update current_feed here, and the update_expired_feeds() call is a bit too late,
          //       so theoretically there could be an inconsistency between active feeds and current_feed.
          //       And note that the next step "process_bids()" is based on current_feed.
       }
-   };
 
-   for( const auto& d : get_index_type<asset_bitasset_data_index>().indices() )
-   {
-      modify( d, update_bitasset );
       if( d.has_settlement() )
          process_bids(d);
    }
@@ -1078,33 +1080,31 @@ void process_hf_868_890( database& db )
 
       // for each feed
       const asset_bitasset_data_object& bitasset_data = current_asset.bitasset_data(db);
-      auto itr = bitasset_data.feeds.begin();
-      while( itr != bitasset_data.feeds.end() )
+      const auto& feed_idx = db.get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>();
+      auto itr = feed_idx.lower_bound( std::make_tuple( bitasset_data.asset_id ) );
+      while( itr != feed_idx.end() && itr->asset_id == bitasset_data.asset_id )
       {
+         const asset_bitasset_feed_object& feed_obj = *itr;
+         ++itr;
          // If the feed is invalid
-         if ( itr->second.second.settlement_price.quote.asset_id != bitasset_data.options.short_backing_asset
-               && ( is_witness_or_committee_fed || itr->second.second.settlement_price != price() ) )
+         if ( feed_obj.feed.settlement_price.quote.asset_id != bitasset_data.options.short_backing_asset
+               && ( is_witness_or_committee_fed || feed_obj.feed.settlement_price != price() ) )
          {
-            db.modify( bitasset_data, [&itr, is_witness_or_committee_fed]( asset_bitasset_data_object& obj )
+            if( is_witness_or_committee_fed )
             {
-               if( is_witness_or_committee_fed )
-               {
-                  // erase the invalid feed
-                  itr = obj.feeds.erase(itr);
-               }
-               else
+               // erase the invalid feed
+               db.remove( feed_obj );
+            }
+            else
+            {
+               // nullify the invalid feed
+               db.modify( feed_obj, []( asset_bitasset_feed_object& f )
                {
-                  // nullify the invalid feed
-                  obj.feeds[itr->first].second.settlement_price = price();
-                  ++itr;
-               }
-            });
-         }
-         else
-         {
-            // Feed is valid. Skip it.
-            ++itr;
+                  f.feed.settlement_price = price();
+               });
+            }
          }
+         // else Feed is valid. Skip it.
       } // end loop of each feed
 
       // always update the median feed due to https://github.com/bitshares/bitshares-core/issues/890
@@ -25,6 +25,7 @@
 #include <graphene/chain/database.hpp>
 
 #include <graphene/chain/chain_property_object.hpp>
+#include <graphene/chain/custom_authority_object.hpp>
 #include <graphene/chain/witness_schedule_object.hpp>
 #include <graphene/chain/special_authority_object.hpp>
 #include <graphene/chain/operation_history_object.hpp>
@@ -32,6 +33,7 @@
 #include <graphene/protocol/fee_schedule.hpp>
 
 #include <fc/io/fstream.hpp>
+#include <fc/thread/parallel.hpp>
 
 #include <fstream>
 #include <functional>
@@ -222,11 +224,51 @@ void database::open(
                     ("last_block->id", last_block)("head_block_id",head_block_num()) );
          reindex( data_dir );
       }
+      warm_up_custom_authority_predicates();
       _opened = true;
    }
    FC_CAPTURE_LOG_AND_RETHROW( (data_dir) )
 }
 
+void database::warm_up_custom_authority_predicates()const
+{
+   const auto& idx = get_index_type<custom_authority_index>().indices();
+   if( idx.empty() )
+      return;
+
+   vector<const custom_authority_object*> auths;
+   auths.reserve( idx.size() );
+   for( const auto& auth : idx )
+      auths.push_back( &auth );
+
+   // Every object is processed by one thread only, since get_predicate() updates the cache in the object
+   const size_t chunks = fc::asio::default_io_service_scope::get_num_threads();
+   const size_t chunk_size = ( auths.size() + chunks - 1 ) / chunks;
+   std::vector<fc::future<void>> workers;
+   workers.reserve( chunks );
+   for( size_t base = 0; base < auths.size(); base += chunk_size )
+      workers.push_back( fc::do_parallel( [&auths,base,chunk_size] () {
+         const size_t end = std::min( base + chunk_size, auths.size() );
+         for( size_t i = base; i < end; ++i )
+         {
+            try
+            {
+               auths[i]->get_predicate();
+            }
+            catch( const fc::exception& e )
+            {
+               wlog( "Unable to compile the restrictions of custom authority ${id}: ${e}",
+                     ("id",auths[i]->id)("e",e.to_detail_string()) );
+            }
+         }
+      }) );
+   for( auto& worker : workers )
+      worker.wait();
+
+   ilog( "Compiled the restrictions of ${n} custom authorities, ${p} distinct predicates",
+         ("n",auths.size())("p",restriction_predicate_registry::instance().size()) );
+}
+
 void database::close(bool rewind)
 {
    if (!_opened)
@@ -272,6 +314,7 @@ void database::close(bool rewind)
       _block_id_to_block.close();
 
    _fork_db.reset();
+   _recent_transactions.clear();
 
    _opened = false;
 }
@@ -524,12 +524,10 @@ static void get_relevant_accounts( const object* obj, flat_set<account_id_type>&
               const auto* aobj = dynamic_cast<const account_statistics_object*>(obj);
               accounts.insert( aobj->owner );
               break;
-           } case impl_transaction_history_object_type:{
-              const auto* aobj = dynamic_cast<const transaction_history_object*>(obj);
-              transaction_get_impacted_accs( aobj->trx, accounts,
-                                             ignore_custom_op_required_auths );
+           } case impl_transaction_history_object_type:
+              // the object only contains the ID of the transaction
               break;
-           } case impl_blinded_balance_object_type:{
+             case impl_blinded_balance_object_type:{
               const auto* aobj = dynamic_cast<const blinded_balance_object*>(obj);
               for( const auto& a : aobj->owner.account_auths )
                 accounts.insert( a.first );
@@ -561,6 +559,10 @@ static void get_relevant_accounts( const object* obj, flat_set<account_id_type>&
               accounts.insert( aobj->offer_owner );
               accounts.insert( aobj->borrower );
               break;
+           } case impl_asset_bitasset_feed_object_type:{
+              const auto* aobj = dynamic_cast<const asset_bitasset_feed_object*>(obj);
+              accounts.insert( aobj->publisher );
+              break;
            }
            // Do not have a default fallback so that there will be a compiler warning when a new type is added
       }
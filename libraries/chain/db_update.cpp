@@ -148,8 +148,9 @@ void database::clear_expired_transactions()
    auto& transaction_idx = static_cast<transaction_index&>(get_mutable_index(implementation_ids,
                                                                              impl_transaction_history_object_type));
    const auto& dedupe_index = transaction_idx.indices().get<by_expiration>();
-   while( (!dedupe_index.empty()) && (head_block_time() > dedupe_index.begin()->trx.expiration) )
+   while( (!dedupe_index.empty()) && (head_block_time() > dedupe_index.begin()->expiration) )
       transaction_idx.remove(*dedupe_index.begin());
+   _recent_transactions.remove_expired( head_block_time() );
 } FC_CAPTURE_AND_RETHROW() }
 
 void database::clear_expired_proposals()
@@ -253,7 +254,8 @@ void database::update_bitasset_current_feed( const asset_bitasset_data_object& b
       {
          const auto& head_time = head_block_time();
          const auto& maint_time = get_dynamic_global_properties().next_maintenance_time;
-         abdo.update_median_feeds( head_time, maint_time );
+         abdo.update_median_feeds( head_time, maint_time,
+               get_index_type<asset_bitasset_feed_index>().indices().get<by_asset_publisher>() );
          abdo.current_feed = abdo.median_feed;
          if( bsrm_type::no_settlement == bsrm || bsrm_type::individual_settlement_to_fund == bsrm )
             new_current_feed_price = get_derived_current_feed_price( *this, abdo );
@@ -24,7 +24,15 @@
 #include <graphene/chain/fork_database.hpp>
 #include <graphene/chain/exceptions.hpp>
 
+#include <boost/pool/pool_alloc.hpp>
+
 namespace graphene { namespace chain {
+
+item_ptr make_fork_item( precomputable_block_ptr b )
+{
+   return std::allocate_shared<fork_item>( boost::fast_pool_allocator<fork_item>(), std::move(b) );
+}
+
 fork_database::fork_database()
 {
 }
@@ -32,6 +40,7 @@ void fork_database::reset()
 {
    _head.reset();
    _index.clear();
+   _branch_cache.clear();
 }
 
 void fork_database::pop_block()
@@ -44,7 +53,12 @@ void fork_database::pop_block()
 
 void     fork_database::start_block(signed_block b)
 {
-   auto item = std::make_shared<fork_item>(std::move(b));
+   start_block( std::make_shared<const precomputable_block>( std::move(b) ) );
+}
+
+void     fork_database::start_block(precomputable_block_ptr b)
+{
+   auto item = make_fork_item( std::move(b) );
    _index.insert(item);
    _head = item;
 }
@@ -55,13 +69,18 @@ void     fork_database::start_block(signed_block b)
  */
 shared_ptr<fork_item>  fork_database::push_block(const signed_block& b)
 {
-   auto item = std::make_shared<fork_item>(b);
+   return push_block( std::make_shared<const precomputable_block>( b ) );
+}
+
+shared_ptr<fork_item>  fork_database::push_block(precomputable_block_ptr b)
+{
+   auto item = make_fork_item( std::move(b) );
    try {
       _push_block(item);
    }
    catch ( const unlinkable_block_exception& e )
    {
-      wlog( "Pushing block to fork database that failed to link: ${id}, ${num}", ("id",b.id())("num",b.block_num()) );
+      wlog( "Pushing block to fork database that failed to link: ${id}, ${num}", ("id",item->id)("num",item->num) );
       wlog( "Head: ${num}, ${id}", ("num",_head->data.block_num())("id",_head->data.id()) );
       throw;
    }
@@ -90,10 +109,25 @@ void  fork_database::_push_block(const item_ptr& item)
    else if( item->num > _head->num )
    {
       _head = item;
-      uint32_t min_num = _head->num - std::min( _max_size, _head->num );
-      auto& num_idx = _index.get<block_num>();
-      while( !num_idx.empty() && (*num_idx.begin())->num < min_num )
-         num_idx.erase( num_idx.begin() );
+      _prune_below( _head->num - std::min( _max_size, _head->num ) );
+   }
+}
+
+void fork_database::_prune_below( uint32_t min_num )
+{
+   auto& num_idx = _index.get<block_num>();
+   auto end = num_idx.lower_bound( min_num );
+   if( end == num_idx.begin() )
+      return;
+   num_idx.erase( num_idx.begin(), end );
+
+   // A cached branch pair stays valid as long as the oldest items of the branches are still known
+   for( auto itr = _branch_cache.begin(); itr != _branch_cache.end(); )
+   {
+      if( itr->second.first.back()->num < min_num )
+         itr = _branch_cache.erase( itr );
+      else
+         ++itr;
    }
 }
 
@@ -102,16 +136,7 @@ void fork_database::set_max_size( uint32_t s )
    _max_size = s;
    if( !_head ) return;
 
-   auto& by_num_idx = _index.get<block_num>();
-   auto itr = by_num_idx.begin();
-   while( itr != by_num_idx.end() )
-   {
-      if( (*itr)->num < std::max(int64_t(0),int64_t(_head->num) - _max_size) )
-         by_num_idx.erase(itr);
-      else
-         break;
-      itr = by_num_idx.begin();
-   }
+   _prune_below( static_cast<uint32_t>( std::max( int64_t(0), int64_t(_head->num) - _max_size ) ) );
 }
 
 bool fork_database::is_known_block(const block_id_type& id)const
@@ -150,6 +175,13 @@ pair<fork_database::branch_type,fork_database::branch_type>
 { try {
    // This function gets a branch (i.e. vector<fork_item>) leading
    // back to the most recent common ancestor.
+   auto cached = _branch_cache.find( branch_key_type( first, second ) );
+   if( cached != _branch_cache.end() )
+      return cached->second;
+   cached = _branch_cache.find( branch_key_type( second, first ) );
+   if( cached != _branch_cache.end() )
+      return std::make_pair( cached->second.second, cached->second.first );
+
    pair<branch_type,branch_type> result;
    auto first_branch_itr = _index.get<block_id>().find(first);
    FC_ASSERT(first_branch_itr != _index.get<block_id>().end());
@@ -160,13 +192,13 @@ pair<fork_database::branch_type,fork_database::branch_type>
    auto second_branch = *second_branch_itr;
 
 
-   while( first_branch->data.block_num() > second_branch->data.block_num() )
+   while( first_branch->num > second_branch->num )
    {
       result.first.push_back(first_branch);
       first_branch = first_branch->prev.lock();
       FC_ASSERT(first_branch);
    }
-   while( second_branch->data.block_num() > first_branch->data.block_num() )
+   while( second_branch->num > first_branch->num )
    {
       result.second.push_back( second_branch );
       second_branch = second_branch->prev.lock();
@@ -186,6 +218,10 @@ pair<fork_database::branch_type,fork_database::branch_type>
       result.first.push_back(first_branch);
       result.second.push_back(second_branch);
    }
+
+   if( _branch_cache.size() >= MAX_BRANCH_CACHE_SIZE )
+      _branch_cache.clear();
+   _branch_cache.emplace( branch_key_type( first, second ), result );
    return result;
 } FC_CAPTURE_AND_RETHROW( (first)(second) ) }
 
@@ -197,6 +233,7 @@ void fork_database::set_head(shared_ptr<fork_item> h)
 void fork_database::remove(block_id_type id)
 {
    _index.get<block_id>().erase(id);
+   _branch_cache.clear();
    // If we're removing head, try to pop it
    if( _head && _head->id == id )
    {
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <graphene/chain/types.hpp>
+#include <graphene/protocol/address.hpp>
+
+#include <boost/container/small_vector.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace graphene { namespace chain {
+
+   /// Hashes account IDs for @ref account_membership_map
+   struct account_id_membership_hash
+   {
+      uint64_t operator()( const account_id_type& id )const { return id.instance.value; }
+   };
+
+   /// Hashes public keys for @ref account_membership_map, the bytes of a key are already uniformly distributed
+   struct public_key_membership_hash
+   {
+      uint64_t operator()( const public_key_type& key )const
+      {
+         uint64_t result;
+         // skip the first byte which only indicates the parity of the Y coordinate
+         std::memcpy( &result, key.key_data.data + 1, sizeof(result) );
+         return result;
+      }
+   };
+
+   /// Hashes addresses for @ref account_membership_map, an address is already a hash
+   struct address_membership_hash
+   {
+      uint64_t operator()( const address& a )const
+      {
+         uint64_t result;
+         std::memcpy( &result, a.addr.data(), sizeof(result) );
+         return result;
+      }
+   };
+
+   /**
+    *  @brief A compact map from a key to the set of accounts which reference the key
+    *
+    *  This is a hash table with open addressing and linear probing, all entries are stored in one array, so there
+    *  is no allocation per key. The accounts of a key are stored in a sorted small vector which keeps one account
+    *  inline, since most keys are referenced by only one account. A key is removed when it is no longer referenced.
+    */
+   template< typename Key, typename Hash >
+   class account_membership_map
+   {
+      public:
+         using account_set = boost::container::small_vector< account_id_type, 1 >;
+
+         /// @return the accounts which reference the key ordered by ID, or @c nullptr if there is none
+         const account_set* find( const Key& key )const
+         {
+            if( _size == 0 )
+               return nullptr;
+            for( size_t i = bucket_of( key ); !_slots[i].accounts.empty(); i = next( i ) )
+            {
+               if( _slots[i].key == key )
+                  return &_slots[i].accounts;
+            }
+            return nullptr;
+         }
+
+         void insert( const Key& key, const account_id_type& account )
+         {
+            reserve( _size + 1 );
+            size_t i = bucket_of( key );
+            while( !_slots[i].accounts.empty() && !( _slots[i].key == key ) )
+               i = next( i );
+            slot& s = _slots[i];
+            if( s.accounts.empty() )
+            {
+               s.key = key;
+               ++_size;
+            }
+            auto itr = std::lower_bound( s.accounts.begin(), s.accounts.end(), account );
+            if( itr == s.accounts.end() || *itr != account )
+               s.accounts.insert( itr, account );
+         }
+
+         void erase( const Key& key, const account_id_type& account )
+         {
+            if( _size == 0 )
+               return;
+            size_t i = bucket_of( key );
+            while( !_slots[i].accounts.empty() && !( _slots[i].key == key ) )
+               i = next( i );
+            slot& s = _slots[i];
+            auto itr = std::lower_bound( s.accounts.begin(), s.accounts.end(), account );
+            if( itr == s.accounts.end() || *itr != account )
+               return;
+            s.accounts.erase( itr );
+            if( s.accounts.empty() )
+            {
+               --_size;
+               close_gap( i );
+            }
+         }
+
+         /// Makes room for @p n keys without rehashing
+         void reserve( size_t n )
+         {
+            // keep the load factor at or below 3/4
+            if( n * 4 <= _slots.size() * 3 )
+               return;
+            size_t capacity = std::max<size_t>( _slots.size(), 16 );
+            while( n * 4 > capacity * 3 )
+               capacity *= 2;
+            rehash( capacity );
+         }
+
+         /// @return the number of keys
+         size_t size()const { return _size; }
+
+         /// Calls @p f with each key and its accounts, in no particular order
+         template< typename Function >
+         void for_each( Function&& f )const
+         {
+            for( const slot& s : _slots )
+            {
+               if( !s.accounts.empty() )
+                  f( s.key, s.accounts );
+            }
+         }
+
+      private:
+         /// An unused slot has no account
+         struct slot
+         {
+            Key         key;
+            account_set accounts;
+         };
+
+         size_t bucket_of( const Key& key )const
+         {  // Fibonacci hashing, takes the high bits
+            return static_cast<size_t>( ( Hash()( key ) * 11400714819323198485ULL ) >> _shift );
+         }
+         size_t next( size_t i )const { return ( i + 1 ) & ( _slots.size() - 1 ); }
+
+         /// Moves the following entries of the probe sequence back into the emptied slot @p hole
+         void close_gap( size_t hole )
+         {
+            const size_t mask = _slots.size() - 1;
+            for( size_t i = next( hole ); !_slots[i].accounts.empty(); i = next( i ) )
+            {
+               const size_t home = bucket_of( _slots[i].key );
+               // the entry can be moved if the hole is between its home slot and its current slot
+               if( ( ( i - home ) & mask ) >= ( ( i - hole ) & mask ) )
+               {
+                  _slots[hole].key = _slots[i].key;
+                  _slots[hole].accounts = std::move( _slots[i].accounts );
+                  _slots[i].accounts.clear();
+                  hole = i;
+               }
+            }
+         }
+
+         void rehash( size_t capacity )
+         {
+            std::vector< slot > old_slots( capacity );
+            std::swap( old_slots, _slots );
+            _shift = 64;
+            for( size_t c = capacity; c > 1; c >>= 1 )
+               --_shift;
+            for( slot& s : old_slots )
+            {
+               if( s.accounts.empty() )
+                  continue;
+               size_t i = bucket_of( s.key );
+               while( !_slots[i].accounts.empty() )
+                  i = next( i );
+               _slots[i].key = s.key;
+               _slots[i].accounts = std::move( s.accounts );
+            }
+         }
+
+         std::vector< slot > _slots;
+         size_t              _size = 0;
+         uint8_t             _shift = 64;
+   };
+
+} } // graphene::chain
@@ -23,6 +23,7 @@
  */
 #pragma once
 
+#include <graphene/chain/account_membership_map.hpp>
 #include <graphene/chain/types.hpp>
 #include <graphene/db/generic_index.hpp>
 #include <graphene/protocol/account.hpp>
@@ -164,6 +165,15 @@ namespace graphene { namespace chain {
          /// Whether need to process this balance object in maintenance interval
          bool              maintenance_flag = false;
 
+         /**
+          * Member groups, which can be passed to modify() to declare which members are changed.
+          * @see graphene::db::modified_fields_type
+          */
+         /// @{
+         static const modified_fields_type owner_fields   = 1; ///< @ref owner and @ref asset_type
+         static const modified_fields_type balance_fields = 2; ///< @ref balance and @ref maintenance_flag
+         /// @}
+
          asset get_balance()const { return asset(balance, asset_type); }
          void  adjust_balance(const asset& delta);
    };
@@ -287,6 +297,17 @@ namespace graphene { namespace chain {
          /// The time when the account was created
          time_point_sec creation_time;
 
+         /**
+          * Member groups, which can be passed to modify() to declare which members are changed.
+          * @see graphene::db::modified_fields_type
+          */
+         /// @{
+         static const modified_fields_type name_field       = 1; ///< @ref name, a key of the account index
+         static const modified_fields_type authority_fields = 2; ///< @ref owner, @ref active and memo key
+         static const modified_fields_type other_fields     = 4; ///< All other members
+         static const modified_fields_type key_fields       = name_field;
+         /// @}
+
          bool has_special_authority()const
          {
             return (!owner_special_authority.is_type< no_special_authority >())
@@ -334,13 +355,25 @@ namespace graphene { namespace chain {
          virtual void object_removed( const object& obj ) override;
          virtual void about_to_modify( const object& before ) override;
          virtual void object_modified( const object& after  ) override;
+         virtual modified_fields_type watched_fields()const override
+         { return account_object::authority_fields; }
 
 
+         /// Inserts all accounts in @p accounts, E.G. when the index is built at startup
+         template< typename AccountRange >
+         void bulk_insert( const AccountRange& accounts )
+         {
+            // most accounts use one key for all authorities and the memo, avoid rehashing for those
+            account_to_key_memberships.reserve( account_to_key_memberships.size() + accounts.size() );
+            for( const account_object& a : accounts )
+               object_inserted( a );
+         }
+
          /** given an account or key, map it to the set of accounts that reference it in an active or owner authority */
-         map< account_id_type, set<account_id_type> >                    account_to_account_memberships;
-         map< public_key_type, set<account_id_type>, pubkey_comparator > account_to_key_memberships;
+         account_membership_map< account_id_type, account_id_membership_hash > account_to_account_memberships;
+         account_membership_map< public_key_type, public_key_membership_hash > account_to_key_memberships;
          /** some accounts use address authorities in the genesis block */
-         map< address, set<account_id_type> >                            account_to_address_memberships;
+         account_membership_map< address, address_membership_hash >            account_to_address_memberships;
 
 
       protected:
@@ -365,9 +398,14 @@ namespace graphene { namespace chain {
          virtual void object_removed( const object& obj ) override;
          virtual void about_to_modify( const object& before ) override;
          virtual void object_modified( const object& after  ) override;
+         virtual modified_fields_type watched_fields()const override
+         { return account_balance_object::owner_fields; }
 
-         const map< asset_id_type, const account_balance_object* >& get_account_balances(
-                  const account_id_type& acct )const;
+         /// Balance objects of one account ordered by asset. Most accounts only hold a few assets,
+         /// a sorted vector is smaller and faster to search than a tree in this case.
+         using account_balance_map = flat_map< asset_id_type, const account_balance_object* >;
+
+         const account_balance_map& get_account_balances( const account_id_type& acct )const;
          const account_balance_object* get_account_balance( const account_id_type& acct,
                                                             const asset_id_type& asset )const;
 
@@ -376,7 +414,7 @@ namespace graphene { namespace chain {
          static const uint64_t mask;
 
          /** Maps each account to its balance objects */
-         vector< vector< map< asset_id_type, const account_balance_object* > > > balances;
+         vector< vector< account_balance_map > > balances;
          std::stack< object_id_type > ids_being_modified;
    };
 
@@ -404,7 +442,8 @@ namespace graphene { namespace chain {
                std::less< account_id_type >
             >
          >
-      >
+      >,
+      pool_allocator< account_balance_object >
    > account_balance_object_multi_index_type;
 
    /**
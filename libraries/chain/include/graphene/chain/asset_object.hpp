@@ -246,6 +246,46 @@ namespace graphene { namespace chain {
       price get_initial_collateralization()const;
    };
 
+   /**
+    *  @brief A price feed published for a bitasset by one feed producer
+    *
+    *  Feeds are stored separately from the @ref asset_bitasset_data_object so that publishing a feed only touches
+    *  this small object, instead of copying all feeds of the asset into the undo database.
+    *
+    *  For assets which are neither witness-fed nor committee-fed, an object also exists for every authorized feed
+    *  producer who has not yet published a feed, with a default @ref publication_time.
+    *
+    *  @ingroup object
+    *  @ingroup implementation
+    */
+   class asset_bitasset_feed_object : public abstract_object<asset_bitasset_feed_object,
+                                                implementation_ids, impl_asset_bitasset_feed_object_type>
+   {
+      public:
+         asset_id_type        asset_id;          ///< The bitasset the feed is published for
+         account_id_type      publisher;         ///< The feed producer
+         time_point_sec       publication_time;  ///< When the feed was published
+         price_feed_with_icr  feed;              ///< The feed
+   };
+
+   struct by_asset_publisher;
+
+   using asset_bitasset_feed_multi_index_type = multi_index_container<
+      asset_bitasset_feed_object,
+      indexed_by<
+         ordered_unique< tag<by_id>, member< object, object_id_type, &object::id > >,
+         ordered_unique< tag<by_asset_publisher>,
+            composite_key< asset_bitasset_feed_object,
+               member< asset_bitasset_feed_object, asset_id_type, &asset_bitasset_feed_object::asset_id >,
+               member< asset_bitasset_feed_object, account_id_type, &asset_bitasset_feed_object::publisher >
+            >
+         >
+      >
+   >;
+   using asset_bitasset_feed_index = generic_index< asset_bitasset_feed_object, asset_bitasset_feed_multi_index_type >;
+   using asset_bitasset_feeds_by_asset_publisher
+         = asset_bitasset_feed_multi_index_type::index<by_asset_publisher>::type;
+
    /**
     *  @brief contains properties that only apply to bitassets (market issued assets)
     *
@@ -262,10 +302,7 @@ namespace graphene { namespace chain {
          /// The tunable options for BitAssets are stored in this field.
          bitasset_options options;
 
-         /// Feeds published for this asset.
-         /// The keys in this map are the feed publishing accounts.
-         /// The timestamp on each feed is the time it was published.
-         flat_map<account_id_type, pair<time_point_sec,price_feed_with_icr>> feeds;
+         // Note: feeds published for this asset are stored in asset_bitasset_feed_object
          /// This is the median of values from the currently active feeds.
          price_feed_with_icr median_feed;
          /// This is the currently active price feed, calculated from @ref median_feed and other parameters.
@@ -386,7 +423,7 @@ namespace graphene { namespace chain {
          /******
           * @brief calculate the median feed
           *
-          * This calculates the median feed from @ref feeds, feed_lifetime_sec
+          * This calculates the median feed from the feeds published for this asset, feed_lifetime_sec
           * in @ref options, and the given parameters.
           * It may update the @ref median_feed, @ref current_feed_publication_time,
           * @ref current_initial_collateralization and
@@ -394,10 +431,12 @@ namespace graphene { namespace chain {
           *
           * @param current_time the current time to use in the calculations
           * @param next_maintenance_time the next chain maintenance time
+          * @param feeds the index of feeds of all bitassets
           *
           * @note Called by @ref database::update_bitasset_current_feed() which updates @ref current_feed afterwards.
           */
-         void update_median_feeds(time_point_sec current_time, time_point_sec next_maintenance_time);
+         void update_median_feeds( time_point_sec current_time, time_point_sec next_maintenance_time,
+                                   const asset_bitasset_feeds_by_asset_publisher& feeds );
       private:
          /// Derive @ref current_maintenance_collateralization and @ref current_initial_collateralization from
          /// other member variables.
@@ -467,6 +506,7 @@ namespace graphene { namespace chain {
 MAP_OBJECT_ID_TO_TYPE(graphene::chain::asset_object)
 MAP_OBJECT_ID_TO_TYPE(graphene::chain::asset_dynamic_data_object)
 MAP_OBJECT_ID_TO_TYPE(graphene::chain::asset_bitasset_data_object)
+MAP_OBJECT_ID_TO_TYPE(graphene::chain::asset_bitasset_feed_object)
 
 FC_REFLECT_DERIVED( graphene::chain::price_feed_with_icr, (graphene::protocol::price_feed),
                     (initial_collateral_ratio) )
@@ -487,9 +527,11 @@ FC_REFLECT_DERIVED( graphene::chain::asset_object, (graphene::db::object),
 
 FC_REFLECT_TYPENAME( graphene::chain::asset_bitasset_data_object )
 FC_REFLECT_TYPENAME( graphene::chain::asset_dynamic_data_object )
+FC_REFLECT_TYPENAME( graphene::chain::asset_bitasset_feed_object )
 
 GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::chain::price_feed_with_icr )
 
 GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::chain::asset_object )
 GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::chain::asset_bitasset_data_object )
 GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::chain::asset_dynamic_data_object )
+GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::chain::asset_bitasset_feed_object )
@@ -40,18 +40,23 @@ namespace graphene { namespace chain {
          void close();
 
          void store( const block_id_type& id, const signed_block& b );
+         /// Same as above, but writes the serialized form cached in @p b instead of packing the block again
+         void store( const block_id_type& id, const precomputable_block& b );
          void remove( const block_id_type& id );
 
          bool                   contains( const block_id_type& id )const;
          block_id_type          fetch_block_id( uint32_t block_num )const;
          optional<signed_block> fetch_optional( const block_id_type& id )const;
          optional<signed_block> fetch_by_number( uint32_t block_num )const;
+         /// @return the serialized block as stored on disk, without deserializing or verifying it
+         optional<vector<char>> fetch_packed_by_number( uint32_t block_num )const;
          optional<signed_block> last()const;
          optional<block_id_type> last_id()const;
          size_t                 blocks_current_position()const;
          size_t                 total_block_size()const;
       private:
          optional<index_entry> last_index_entry()const;
+         void store_packed( const block_id_type& id, const signed_block& b, const vector<char>& packed );
          fc::path _index_filename;
          mutable std::fstream _blocks;
          mutable std::fstream _block_num_to_pos;
@@ -29,8 +29,61 @@
 #include <graphene/chain/types.hpp>
 #include <boost/multi_index/composite_key.hpp>
 
+#include <list>
+#include <map>
+#include <mutex>
+
 namespace graphene { namespace chain {
 
+   /**
+    * @brief A registry of compiled restriction predicates, shared by all custom authorities
+    *
+    * Compiling restrictions into a predicate function is expensive. The registry keeps the compiled predicates
+    * keyed by a hash of the operation type and the restrictions, so that a predicate is compiled only once per
+    * process, no matter how many objects (including copies made by the undo database) have the same restrictions.
+    * It is safe to use from multiple threads, and can be warmed up in advance, E.G. at startup.
+    *
+    * The number of predicates kept is bounded, the least recently used ones are evicted first. Objects keep their
+    * own copy of the predicate, so an evicted predicate is only compiled again for objects without one.
+    */
+   class restriction_predicate_registry
+   {
+   public:
+      /// @return the registry shared by all databases in the process
+      static restriction_predicate_registry& instance();
+
+      /// Get the predicate of the restrictions from the registry, compile and store it if not found
+      restriction_predicate_function get( const vector<restriction>& rs, const unsigned_int& op_type );
+
+      /// @return the number of compiled predicates in the registry
+      size_t size()const;
+
+      /// @return the maximum number of compiled predicates kept in the registry
+      size_t get_capacity()const;
+      /// Set the maximum number of compiled predicates kept in the registry, evict predicates if needed
+      void set_capacity( size_t capacity );
+
+      static constexpr size_t default_capacity = 10000;
+
+   private:
+      static digest_type get_key( const vector<restriction>& rs, const unsigned_int& op_type );
+      /// Evict the least recently used predicates until the capacity is respected, the caller holds the lock
+      void evict();
+
+      using lru_list = std::list<digest_type>;
+      struct entry
+      {
+         restriction_predicate_function predicate;
+         lru_list::iterator             lru_position;
+      };
+
+      mutable std::mutex _mutex;
+      size_t _capacity = default_capacity;
+      /// Keys of the predicates, most recently used first
+      lru_list _lru;
+      std::map<digest_type, entry> _predicates;
+   };
+
    /**
     * @brief Tracks account custom authorities
     * @ingroup object
@@ -72,7 +125,7 @@ namespace graphene { namespace chain {
       }
       /// Regenerate predicate function and update predicate cache
       void update_predicate_cache() const {
-         predicate_cache = get_restriction_predicate(get_restrictions(), operation_type);
+         predicate_cache = restriction_predicate_registry::instance().get(get_restrictions(), operation_type);
       }
       /// Clear the cache of the predicate function
       void clear_predicate_cache() { predicate_cache.reset(); }
@@ -32,7 +32,9 @@
 #include <graphene/chain/fork_database.hpp>
 #include <graphene/chain/block_database.hpp>
 #include <graphene/chain/genesis_state.hpp>
+#include <graphene/chain/read_write_mutex.hpp>
 #include <graphene/chain/evaluator.hpp>
+#include <graphene/chain/transaction_history_object.hpp>
 
 #include <graphene/db/object_database.hpp>
 #include <graphene/db/object.hpp>
@@ -42,6 +44,7 @@
 #include <fc/log/logger.hpp>
 
 #include <map>
+#include <shared_mutex>
 
 namespace graphene { namespace protocol { struct predicate_result; } }
 
@@ -215,6 +218,13 @@ namespace graphene { namespace chain {
          /// @return nullptr if not found, pointer to the limit order if found
          const limit_order_object* find_settled_debt_order( const asset_id_type& a )const;
 
+         /// Get the feeds of a bitasset
+         /// @param bitasset The bitasset object
+         /// @return the feeds and their publication time by feed producer, including authorized feed producers
+         ///         which have not published a feed yet
+         flat_map<account_id_type, pair<time_point_sec,price_feed_with_icr>> get_bitasset_feeds(
+               const asset_bitasset_data_object& bitasset )const;
+
          /// Find the call order with the least collateral ratio
          /// @param bitasset The bitasset object
          /// @param force_by_collateral_index Whether to forcefully search via the by_collateral index
@@ -546,7 +556,10 @@ namespace graphene { namespace chain {
          block_id_type              get_block_id_for_num( uint32_t block_num )const;
          optional<signed_block>     fetch_block_by_id( const block_id_type& id )const;
          optional<signed_block>     fetch_block_by_number( uint32_t num )const;
-         const signed_transaction&  get_recent_transaction( const transaction_id_type& trx_id )const;
+         /// @return the serialized block, read from the fork database or the block log without deserializing it
+         optional<vector<char>>     fetch_packed_block_by_number( uint32_t num )const;
+         /// @return a transaction which is known as in @ref is_known_transaction and still in the recent cache
+         signed_transaction         get_recent_transaction( const transaction_id_type& trx_id )const;
          std::vector<block_id_type> get_block_ids_on_fork(block_id_type head_of_fork) const;
 
          void                       add_checkpoints( const flat_map<uint32_t,block_id_type>& checkpts );
@@ -554,9 +567,11 @@ namespace graphene { namespace chain {
          bool before_last_checkpoint()const;
 
          bool push_block( const signed_block& b, uint32_t skip = skip_nothing );
+         /// Same as above, but the block is shared with the fork database and the block database instead of copied
+         bool push_block( const precomputable_block_ptr& b, uint32_t skip = skip_nothing );
          processed_transaction push_transaction( const precomputable_transaction& trx, uint32_t skip = skip_nothing );
       private:
-         bool _push_block( const signed_block& b );
+         bool _push_block( const precomputable_block_ptr& b );
       public:
          // It is public because it is used in pending_transactions_restorer in db_with.hpp
          processed_transaction _push_transaction( const precomputable_transaction& trx );
@@ -580,6 +595,16 @@ namespace graphene { namespace chain {
          void pop_block();
          void clear_pending();
 
+         /**
+          *  @brief Acquire shared access to the objects for reading them from a thread other than the one which
+          *  pushes blocks and transactions.
+          *
+          *  The lock is held exclusively while a block or a transaction is being pushed, a block is being generated
+          *  or popped, or pending transactions are being cleared. Must not be called by the thread which modifies
+          *  the database. A waiting writer blocks new readers, so this call may wait until the writer has finished.
+          */
+         std::shared_lock<read_write_mutex> read_lock()const;
+
          /**
           *  This method is used to track appied operations during the evaluation of a block, these
           *  operations should include any operation actually included in a transaction as well
@@ -668,6 +693,9 @@ namespace graphene { namespace chain {
          template<typename Trx>
          void _precompute_parallel( const Trx* trx, const size_t count, const uint32_t skip )const;
 
+         /// Compiles the restriction predicates of all custom authorities in parallel threads
+         void warm_up_custom_authority_predicates()const;
+
       protected:
          // Mark pop_undo() as protected -- we do not want outside calling pop_undo(),
          // it should call pop_block() instead
@@ -683,13 +711,13 @@ namespace graphene { namespace chain {
       public:
          // these were formerly private, but they have a fairly well-defined API, so let's make them public
          void                  apply_block( const signed_block& next_block, uint32_t skip = skip_nothing );
-         processed_transaction apply_transaction( const signed_transaction& trx, uint32_t skip = skip_nothing );
+         processed_transaction apply_transaction( const precomputable_transaction& trx, uint32_t skip = skip_nothing );
          operation_result      apply_operation( transaction_evaluation_state& eval_state, const operation& op,
                                                 bool is_virtual = true );
 
       private:
          void                  _apply_block( const signed_block& next_block );
-         processed_transaction _apply_transaction( const signed_transaction& trx );
+         processed_transaction _apply_transaction( const precomputable_transaction& trx );
 
          ///Steps involved in applying a new block
          ///@{
@@ -794,6 +822,9 @@ namespace graphene { namespace chain {
          /// Set it to true to provide accurate data to API clients, set to false to have better performance.
          bool                              _track_standby_votes = true;
 
+         /// Bodies of the transactions in the transaction de-duplication index
+         recent_transaction_cache          _recent_transactions;
+
          /**
           * Whether database is successfully opened or not.
           *
@@ -806,6 +837,11 @@ namespace graphene { namespace chain {
          // Counts nested proposal updates
          uint32_t                          _push_proposal_nesting_depth = 0;
 
+         /// Guards the objects against readers on other threads, see @ref read_lock
+         mutable read_write_mutex          _read_write_mutex;
+         // Counts nested modifications, only the outermost one locks _read_write_mutex
+         uint32_t                          _write_nesting_depth = 0;
+
          /// Tracks assets affected by bitshares-core issue #453 before hard fork #615 in one block
          flat_set<asset_id_type>           _issue_453_affected_assets;
 
@@ -818,9 +854,15 @@ namespace graphene { namespace chain {
          const chain_property_object*           _p_chain_property_obj      = nullptr;
          const witness_schedule_object*         _p_witness_schedule_obj    = nullptr;
          ///@}
+
+         /// The balances of each account, used by @ref get_balance and @ref adjust_balance.
+         /// Set in @ref initialize_indexes, the secondary index lives as long as the primary index.
+         const balances_by_account_index*       _p_balances_by_account     = nullptr;
       public:
          /// Enable or disable tracking of votes of standby witnesses and committee members
          inline void enable_standby_votes_tracking(bool enable)  { _track_standby_votes = enable; }
+         /// Set the maximum number of recent transactions kept for @ref get_recent_transaction
+         inline void set_recent_transactions_cache_size( size_t size )  { _recent_transactions.set_capacity( size ); }
    };
 
 } }
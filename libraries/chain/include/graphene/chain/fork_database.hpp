@@ -39,15 +39,20 @@ namespace graphene { namespace chain {
 
    struct fork_item
    {
-      fork_item( signed_block d )
-      :num(d.block_num()),id(d.id()),data( std::move(d) ){}
+      explicit fork_item( precomputable_block_ptr d )
+      :num(d->block_num()),id(d->id()),block( std::move(d) ),data( *block ){}
+
+      fork_item( const fork_item& ) = delete;
+      fork_item& operator=( const fork_item& ) = delete;
 
       block_id_type previous_id()const { return data.previous; }
 
       weak_ptr< fork_item > prev;
       uint32_t              num;    // initialized in ctor
       block_id_type         id;
-      signed_block          data;
+      /// the block body, shared with whoever handed it in (p2p layer, block generation etc.) instead of copied
+      precomputable_block_ptr        block;
+      const precomputable_block&     data; // always refers to *block
 
       // contains witness block signing keys scheduled *after* the block has been applied
       shared_ptr< vector< pair< witness_id_type, public_key_type > > > scheduled_witnesses;
@@ -56,6 +61,13 @@ namespace graphene { namespace chain {
    };
    typedef shared_ptr<fork_item> item_ptr;
 
+   /**
+    *  Allocates a fork_item together with its control block from a pool shared by all fork databases.
+    *  Fork items are created and dropped at the same rate blocks arrive, so recycling the nodes avoids
+    *  hitting the general purpose allocator on every push.
+    */
+   item_ptr make_fork_item( precomputable_block_ptr b );
+
 
    /**
     *  As long as blocks are pushed in order the fork
@@ -78,6 +90,7 @@ namespace graphene { namespace chain {
          void reset();
 
          void                             start_block(signed_block b);
+         void                             start_block(precomputable_block_ptr b);
          void                             remove(block_id_type b);
          void                             set_head(shared_ptr<fork_item> h);
          bool                             is_known_block(const block_id_type& id)const;
@@ -88,12 +101,17 @@ namespace graphene { namespace chain {
           *  @return the new head block ( the longest fork )
           */
          shared_ptr<fork_item>            push_block(const signed_block& b);
+         /// Same as above, but the fork database keeps a reference to @p b instead of copying it
+         shared_ptr<fork_item>            push_block(precomputable_block_ptr b);
          shared_ptr<fork_item>            head()const { return _head; }
          void                             pop_block();
 
          /**
           *  Given two head blocks, return two branches of the fork graph that
           *  end with a common ancestor (same prior block)
+          *
+          *  Results are cached until a block is removed from the fork database, so that repeated
+          *  queries for the same pair of competing heads do not walk the branches again.
           */
          pair< branch_type, branch_type >  fetch_branch_from(block_id_type first,
                                                              block_id_type second)const;
@@ -114,10 +132,18 @@ namespace graphene { namespace chain {
          /** @return a pointer to the newly pushed item */
          void _push_block(const item_ptr& b );
          void _push_next(const item_ptr& newly_inserted);
+         /// Removes all items with a block number lower than @p min_num
+         void _prune_below( uint32_t min_num );
+
+         /// The maximum number of (first,second) pairs remembered by fetch_branch_from()
+         const static size_t MAX_BRANCH_CACHE_SIZE = 16;
 
          uint32_t                 _max_size = 1024;
 
          fork_multi_index_type    _index;
          shared_ptr<fork_item>    _head;
+
+         typedef pair< block_id_type, block_id_type > branch_key_type;
+         mutable flat_map< branch_key_type, pair< branch_type, branch_type > > _branch_cache;
    };
 } } // graphene::chain
@@ -110,7 +110,8 @@ typedef multi_index_container<
          >,
          composite_key_compare<std::less<account_id_type>, std::greater<price>, std::less<object_id_type>>
       >
-   >
+   >,
+   pool_allocator< limit_order_object >
 > limit_order_multi_index_type;
 
 typedef generic_index<limit_order_object, limit_order_multi_index_type> limit_order_index;
@@ -227,7 +228,8 @@ typedef multi_index_container<
             member< object, object_id_type, &object::id >
          >
       >
-   >
+   >,
+   pool_allocator< call_order_object >
 > call_order_multi_index_type;
 
 struct by_expiration;
@@ -248,7 +250,8 @@ typedef multi_index_container<
             member< object, object_id_type, &object::id >
          >
       >
-   >
+   >,
+   pool_allocator< force_settlement_object >
 > force_settlement_object_multi_index_type;
 
 typedef multi_index_container<
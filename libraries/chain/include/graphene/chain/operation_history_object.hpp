@@ -127,7 +127,8 @@ namespace graphene { namespace chain {
                std::greater< object_id_type >
             >
          >
-      >
+      >,
+      pool_allocator< operation_history_object >
    >;
 
    using operation_history_index = generic_index< operation_history_object, operation_history_mlti_idx_type >;
@@ -159,7 +160,8 @@ namespace graphene { namespace chain {
          ordered_non_unique< tag<by_opid>,
             member< account_history_object, operation_history_id_type, &account_history_object::operation_id>
          >
-      >
+      >,
+      pool_allocator< account_history_object >
    >;
 
    using account_history_index = generic_index< account_history_object, account_history_multi_idx_type >;
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace graphene { namespace chain {
+
+/**
+ * @brief A readers-writer lock which prefers writers
+ *
+ * std::shared_timed_mutex gives no guarantee about fairness, and with glibc new readers are admitted as long as
+ * any reader holds the lock, so a constant load of overlapping readers can delay a writer indefinitely.
+ * Here a waiting writer blocks new readers, so it only waits for the readers which already hold the lock.
+ *
+ * Meets the requirements of std::unique_lock and std::shared_lock. Not recursive: a thread which holds the lock
+ * in any mode must not lock it again.
+ */
+class read_write_mutex
+{
+public:
+   read_write_mutex() = default;
+   read_write_mutex( const read_write_mutex& ) = delete;
+   read_write_mutex& operator=( const read_write_mutex& ) = delete;
+
+   void lock()
+   {
+      std::unique_lock<std::mutex> guard( _mutex );
+      ++_waiting_writers;
+      _writer_cv.wait( guard, [this]() { return !_writer_active && 0 == _active_readers; } );
+      --_waiting_writers;
+      _writer_active = true;
+   }
+
+   void unlock()
+   {
+      {
+         std::lock_guard<std::mutex> guard( _mutex );
+         _writer_active = false;
+      }
+      // Readers re-check for waiting writers themselves
+      _writer_cv.notify_one();
+      _reader_cv.notify_all();
+   }
+
+   void lock_shared()
+   {
+      std::unique_lock<std::mutex> guard( _mutex );
+      _reader_cv.wait( guard, [this]() { return !_writer_active && 0 == _waiting_writers; } );
+      ++_active_readers;
+   }
+
+   void unlock_shared()
+   {
+      bool wake_writer = false;
+      {
+         std::lock_guard<std::mutex> guard( _mutex );
+         wake_writer = ( 0 == --_active_readers && _waiting_writers > 0 );
+      }
+      if( wake_writer )
+         _writer_cv.notify_one();
+   }
+
+   /// @return the number of threads waiting for exclusive access
+   uint32_t waiting_writers()const
+   {
+      std::lock_guard<std::mutex> guard( _mutex );
+      return _waiting_writers;
+   }
+
+private:
+   mutable std::mutex        _mutex;
+   std::condition_variable   _writer_cv;
+   std::condition_variable   _reader_cv;
+   uint32_t                  _active_readers = 0;
+   uint32_t                  _waiting_writers = 0;
+   bool                      _writer_active = false;
+};
+
+} } // graphene::chain
@@ -31,6 +31,9 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+#include <mutex>
 
 namespace graphene { namespace chain {
    using namespace graphene::db;
@@ -40,15 +43,16 @@ namespace graphene { namespace chain {
     * The purpose of this object is to enable the detection of duplicate transactions. When a transaction is included
     * in a block a transaction_history_object is added. At the end of block processing all transaction_history_objects that
     * have expired can be removed from the index.
+    *
+    * Only the ID and the expiration of the transaction are stored, the body of a recent transaction is kept in the
+    * @ref recent_transaction_cache.
     */
    class transaction_history_object : public abstract_object<transaction_history_object,
                                                 implementation_ids, impl_transaction_history_object_type>
    {
       public:
-         signed_transaction  trx;
          transaction_id_type trx_id;
-
-         time_point_sec get_expiration()const { return trx.expiration; }
+         time_point_sec      expiration;
    };
 
    struct by_expiration;
@@ -59,12 +63,60 @@ namespace graphene { namespace chain {
          ordered_unique< tag<by_id>, member< object, object_id_type, &object::id > >,
          hashed_unique< tag<by_trx_id>, BOOST_MULTI_INDEX_MEMBER(transaction_history_object, transaction_id_type, trx_id),
                         std::hash<transaction_id_type> >,
-         ordered_non_unique< tag<by_expiration>, const_mem_fun< transaction_history_object, time_point_sec,
-                                                                &transaction_history_object::get_expiration > >
+         ordered_non_unique< tag<by_expiration>,
+                             member< transaction_history_object, time_point_sec, &transaction_history_object::expiration > >
       >
    > transaction_multi_index_type;
 
    typedef generic_index<transaction_history_object, transaction_multi_index_type> transaction_index;
+
+   /**
+    * Keeps the bodies of recently applied transactions, so that they can be served to API clients and to peers.
+    *
+    * This is not part of the object database, the transactions are neither copied into undo sessions nor saved
+    * with the object database. The number of transactions is bounded, the oldest ones are dropped first when
+    * the cache is full. It is safe to use from multiple threads.
+    */
+   class recent_transaction_cache
+   {
+      public:
+         static constexpr size_t default_capacity = 100000;
+
+         /// Adds a transaction unless it is already cached
+         void add( const transaction_id_type& id, const signed_transaction& trx );
+         /// @return the transaction if it is cached
+         optional<signed_transaction> find( const transaction_id_type& id )const;
+         /// Removes the transactions which expired before @p now
+         void remove_expired( const time_point_sec now );
+         void clear();
+
+         /// Sets the maximum number of transactions to keep, 0 disables the cache
+         void set_capacity( size_t capacity );
+         size_t size()const;
+
+      private:
+         struct entry
+         {
+            transaction_id_type id;
+            time_point_sec      expiration;
+            signed_transaction  trx;
+         };
+         typedef multi_index_container<
+            entry,
+            indexed_by<
+               sequenced<>,
+               hashed_unique< tag<by_trx_id>, member< entry, transaction_id_type, &entry::id >,
+                              std::hash<transaction_id_type> >,
+               ordered_non_unique< tag<by_expiration>, member< entry, time_point_sec, &entry::expiration > >
+            >
+         > entry_multi_index_type;
+
+         void shrink_to_capacity();
+
+         size_t                 _capacity = default_capacity;
+         entry_multi_index_type _entries;
+         mutable std::mutex     _mutex;
+   };
 } }
 
 MAP_OBJECT_ID_TO_TYPE(graphene::chain::transaction_history_object)
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <graphene/chain/transaction_history_object.hpp>
+
+namespace graphene { namespace chain {
+
+void recent_transaction_cache::add( const transaction_id_type& id, const signed_transaction& trx )
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   if( _capacity == 0 || _entries.get<by_trx_id>().find( id ) != _entries.get<by_trx_id>().end() )
+      return;
+   _entries.push_back( entry{ id, trx.expiration, trx } );
+   shrink_to_capacity();
+}
+
+optional<signed_transaction> recent_transaction_cache::find( const transaction_id_type& id )const
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   const auto& idx = _entries.get<by_trx_id>();
+   auto itr = idx.find( id );
+   if( itr == idx.end() )
+      return optional<signed_transaction>();
+   return itr->trx;
+}
+
+void recent_transaction_cache::remove_expired( const time_point_sec now )
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   auto& idx = _entries.get<by_expiration>();
+   idx.erase( idx.begin(), idx.lower_bound( now ) );
+}
+
+void recent_transaction_cache::clear()
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   _entries.clear();
+}
+
+void recent_transaction_cache::set_capacity( size_t capacity )
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   _capacity = capacity;
+   shrink_to_capacity();
+}
+
+size_t recent_transaction_cache::size()const
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   return _entries.size();
+}
+
+void recent_transaction_cache::shrink_to_capacity()
+{
+   while( _entries.size() > _capacity )
+      _entries.pop_front();
+}
+
+} } // graphene::chain
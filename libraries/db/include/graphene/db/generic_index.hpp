@@ -55,7 +55,7 @@ namespace graphene { namespace db {
             return *insert_result.first;
          }
 
-         const object&  create(const std::function<void(object&)>& constructor )override
+         const object&  create(object_callback constructor )override
          {
             ObjectType item;
             item.id = get_next_id();
@@ -67,7 +67,7 @@ namespace graphene { namespace db {
             return *insert_result.first;
          }
 
-         void modify( const object& obj, const std::function<void(object&)>& m )override
+         void modify( const object& obj, object_callback m )override
          {
             assert(nullptr != dynamic_cast<const ObjectType*>(&obj));
             std::exception_ptr exc;
@@ -90,6 +90,16 @@ namespace graphene { namespace db {
             FC_ASSERT(ok, "Could not modify object, most likely an index constraint was violated");
          }
 
+         void modify( const object& obj, object_callback m,
+                      modified_fields_type fields )override
+         {
+            if( 0 != ( fields & ObjectType::key_fields ) )
+               return generic_index::modify( obj, m );
+            // No key is changed, so there is no need to check or update the positions of the object in the indices
+            assert(nullptr != dynamic_cast<const ObjectType*>(&obj));
+            m( const_cast<ObjectType&>( static_cast<const ObjectType&>(obj) ) );
+         }
+
          void remove( const object& obj )override
          {
             _indices.erase( _indices.iterator_to( static_cast<const ObjectType&>(obj) ) );
@@ -51,6 +51,33 @@ namespace graphene { namespace db {
          virtual void on_modify( const object& obj ){}
    };
 
+   /**
+    * @brief A non-owning reference to a callable with the signature void(object&)
+    *
+    * It is used instead of std::function to pass the constructors and modifiers of objects through the
+    * virtual methods of @ref index: it never allocates and calls the referenced callable directly.
+    * The referenced callable must outlive the object_callback, which is always the case when it is
+    * passed as an argument.
+    */
+   class object_callback
+   {
+      public:
+         template<typename Callable,
+                  typename = std::enable_if_t< !std::is_same< std::decay_t<Callable>, object_callback >::value > >
+         object_callback( Callable&& c )
+         : _callable( const_cast<void*>( static_cast<const void*>( std::addressof(c) ) ) ),
+           _invoke( []( void* callable, object& o ) {
+              (*static_cast< std::remove_reference_t<Callable>* >( callable ))( o );
+           } )
+         {}
+
+         void operator()( object& o )const { _invoke( _callable, o ); }
+
+      private:
+         void* _callable;
+         void (*_invoke)( void* callable, object& o );
+   };
+
    /**
     *  @class index
     *  @brief abstract base class for accessing objects indexed in various ways.
@@ -90,7 +117,7 @@ namespace graphene { namespace db {
           * Builds a new object and assigns it the next available ID and then
           * initializes it with constructor and lastly inserts it into the index.
           */
-         virtual const object&  create( const std::function<void(object&)>& constructor ) = 0;
+         virtual const object&  create( object_callback constructor ) = 0;
 
          /**
           *  Opens the index loading objects from a file
@@ -114,7 +141,14 @@ namespace graphene { namespace db {
             return *maybe_found;
          }
 
-         virtual void               modify( const object& obj, const std::function<void(object&)>& ) = 0;
+         virtual void               modify( const object& obj, object_callback ) = 0;
+         /**
+          * Modifies obj, changing only the member groups declared in fields.
+          * The default implementation ignores fields.
+          */
+         virtual void               modify( const object& obj, object_callback m,
+                                            modified_fields_type fields )
+         { modify( obj, m ); }
          virtual void               remove( const object& obj ) = 0;
 
          /**
@@ -126,7 +160,14 @@ namespace graphene { namespace db {
          template<typename Object, typename Lambda>
          void modify( const Object& obj, const Lambda& l ) {
             modify( static_cast<const object&>(obj),
-                    std::function<void(object&)>( [&l]( object& o ){ l( static_cast<Object&>(o) ); } ) );
+                    object_callback( [&l]( object& o ){ l( static_cast<Object&>(o) ); } ) );
+         }
+
+         template<typename Object, typename Lambda>
+         void modify( const Object& obj, const Lambda& l, modified_fields_type fields ) {
+            modify( static_cast<const object&>(obj),
+                    object_callback( [&l]( object& o ){ l( static_cast<Object&>(o) ); } ),
+                    fields );
          }
 
          virtual void inspect_all_objects(std::function<void(const object&)> inspector)const = 0;
@@ -144,8 +185,23 @@ namespace graphene { namespace db {
          virtual void object_removed( const object& obj ){};
          virtual void about_to_modify( const object& before ){};
          virtual void object_modified( const object& after  ){};
+         /// @return the member groups this index depends on, it is not notified about modifications of others
+         virtual modified_fields_type watched_fields()const { return all_fields; }
    };
 
+   namespace detail {
+      /// @return a new number to identify a secondary index type, numbers are assigned from 0 upwards
+      size_t next_secondary_index_type_number();
+
+      /// @return the number which identifies the secondary index type @p T in all primary indexes
+      template<typename T>
+      size_t secondary_index_type_number()
+      {
+         static const size_t number = next_secondary_index_type_number();
+         return number;
+      }
+   }
+
    /**
     *   Defines the common implementation
     */
@@ -172,12 +228,22 @@ namespace graphene { namespace db {
          T* add_secondary_index(Args... args)
          {
             _sindex.emplace_back( std::make_unique<T>(args...) );
-            return static_cast<T*>(_sindex.back().get());
+            T* result = static_cast<T*>(_sindex.back().get());
+            const size_t number = detail::secondary_index_type_number<T>();
+            if( _sindex_by_type.size() <= number )
+               _sindex_by_type.resize( number + 1, nullptr );
+            if( nullptr == _sindex_by_type[number] ) // the first one of a type is found by get_secondary_index
+               _sindex_by_type[number] = result;
+            return result;
          }
 
          template<typename T>
          const T& get_secondary_index()const
          {
+            const size_t number = detail::secondary_index_type_number<T>();
+            if( number < _sindex_by_type.size() && nullptr != _sindex_by_type[number] )
+               return *static_cast<const T*>( _sindex_by_type[number] );
+            // Not added with this exact type, look for a derived type
             for( const auto& item : _sindex )
             {
                const T* result = dynamic_cast<const T*>(item.get());
@@ -189,6 +255,8 @@ namespace graphene { namespace db {
       protected:
          std::vector< std::shared_ptr<index_observer> >   _observers;
          std::vector< std::unique_ptr<secondary_index> >  _sindex;
+         /// The secondary indexes by the numbers of their types, see @ref detail::secondary_index_type_number
+         std::vector< secondary_index* >                  _sindex_by_type;
 
       private:
          object_database& _db;
@@ -250,13 +318,13 @@ namespace graphene { namespace db {
                   next++;
                }
             }
-            FC_ASSERT( nullptr != dynamic_cast<const Object*>(&obj), "Wrong object type!" );
+            assert( nullptr != dynamic_cast<const Object*>(&obj) ); // only the primary index of Object calls this
             content[instance >> chunkbits][instance & _mask] = static_cast<const Object*>( &obj );
          }
 
          void object_removed( const object& obj ) override
          {
-            FC_ASSERT( nullptr != dynamic_cast<const Object*>(&obj), "Wrong object type!" );
+            assert( nullptr != dynamic_cast<const Object*>(&obj) );
             uint64_t instance = obj.id.instance();
             FC_ASSERT( instance < next, "Removing out-of-range object: {id} > {next}!", ("id",obj.id)("next",next) );
             FC_ASSERT( content[instance >> chunkbits][instance & _mask],
@@ -389,7 +457,7 @@ namespace graphene { namespace db {
          }
 
 
-         const object&  create(const std::function<void(object&)>& constructor )override
+         const object&  create(object_callback constructor )override
          {
             const auto& result = DerivedIndex::create( constructor );
             for( const auto& item : _sindex )
@@ -415,7 +483,7 @@ namespace graphene { namespace db {
             DerivedIndex::remove(obj);
          }
 
-         void modify( const object& obj, const std::function<void(object&)>& m )override
+         void modify( const object& obj, object_callback m )override
          {
             save_undo( obj );
             for( const auto& item : _sindex )
@@ -426,6 +494,24 @@ namespace graphene { namespace db {
             on_modify( obj );
          }
 
+         void modify( const object& obj, object_callback m,
+                      modified_fields_type fields )override
+         {
+            save_undo( obj );
+            for( const auto& item : _sindex )
+            {
+               if( 0 != ( item->watched_fields() & fields ) )
+                  item->about_to_modify( obj );
+            }
+            DerivedIndex::modify( obj, m, fields );
+            for( const auto& item : _sindex )
+            {
+               if( 0 != ( item->watched_fields() & fields ) )
+                  item->object_modified( obj );
+            }
+            on_modify( obj );
+         }
+
          void add_observer( const std::shared_ptr<index_observer>& o ) override
          {
             _observers.emplace_back( o );
@@ -24,12 +24,24 @@
 #pragma once
 #include <boost/multiprecision/integer.hpp>
 #include <graphene/protocol/object_id.hpp>
+#include <graphene/db/object_pool.hpp>
 #include <fc/io/raw.hpp>
 #include <fc/crypto/city.hpp>
 
 #define MAX_NESTING (200)
 
 namespace graphene { namespace db {
+   /**
+    *  @brief A set of member groups of an object, used to declare which members a call to modify() may change
+    *
+    *  The meaning of each bit is defined by the object type, see e.g. @ref graphene::chain::account_object.
+    *  Secondary indexes which do not watch any of the declared groups are not notified about the modification,
+    *  and the primary index skips re-keying if none of the declared groups is a key of the index.
+    */
+   using modified_fields_type = uint64_t;
+   /// Any member may be changed, this is the default of modify()
+   constexpr modified_fields_type all_fields = ~modified_fields_type(0);
+
    /**
     *  @brief base for all database objects
     *
@@ -82,10 +94,12 @@ namespace graphene { namespace db {
     * @brief   Use the Curiously Recurring Template Pattern to automatically add the ability to
     *  clone, serialize, and move objects polymorphically.
     *
+    *  Objects allocated on the heap, i.e. the copies kept by the undo database, are taken from a pool per type.
+    *
     *  http://en.wikipedia.org/wiki/Curiously_recurring_template_pattern
     */
    template<typename DerivedClass>
-   class base_abstract_object : public object
+   class base_abstract_object : public object, public pool_allocated<DerivedClass>
    {
       public:
          using object::object; // constructors
@@ -109,6 +123,8 @@ namespace graphene { namespace db {
    public:
       static constexpr uint8_t space_id = SpaceID;
       static constexpr uint8_t type_id = TypeID;
+      /// Member groups which are keys of the index of this object type, derived classes may redefine it
+      static constexpr modified_fields_type key_fields = all_fields;
       abstract_object() : base_abstract_object<DerivedClass>( space_id, type_id ) {}
       object_id<SpaceID,TypeID> get_id() const { return object_id<SpaceID,TypeID>( this->id ); }
    };
@@ -99,6 +99,11 @@ namespace graphene { namespace db {
          void modify( const T& obj, const Lambda& m ) {
             get_mutable_index(obj.id).modify(obj,m);
          }
+         /// Modify obj, declaring that only the given member groups are changed, see @ref modified_fields_type
+         template<typename T, typename Lambda>
+         void modify( const T& obj, const Lambda& m, modified_fields_type fields ) {
+            get_mutable_index(obj.id).modify(obj,m,fields);
+         }
 
          ///@}
 
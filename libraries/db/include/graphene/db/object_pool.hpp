@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <fc/reflect/reflect.hpp>
+
+#include <boost/core/demangle.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace graphene { namespace db {
+
+   /// Usage of one @ref object_pool, as returned by @ref object_pool::get_all_statistics
+   struct object_pool_statistics
+   {
+      std::string name;               ///< The type whose memory is managed by the pool
+      uint32_t    node_size = 0;      ///< Size of each memory block in bytes
+      uint64_t    nodes_in_use = 0;   ///< Number of blocks handed out and not yet returned
+      uint64_t    nodes_free = 0;     ///< Number of blocks waiting for reuse
+      uint64_t    bytes_reserved = 0; ///< Total size of the slabs allocated by the pool
+   };
+
+   /**
+    * @brief A pool of equally sized memory blocks, carved out of large slabs.
+    *
+    * Freed blocks are kept in a free list and reused for the next allocation of the same pool, slabs are never
+    * returned to the system. Objects which are created and removed all the time, like orders and their undo
+    * copies, thus reuse the same memory instead of fragmenting the heap.
+    *
+    * All pools of the process are registered, so that their usage can be inspected. Pools are thread safe.
+    */
+   class object_pool
+   {
+      public:
+         object_pool( const object_pool& ) = delete;
+         object_pool& operator=( const object_pool& ) = delete;
+
+         void* allocate();
+         void  deallocate( void* p );
+
+         object_pool_statistics get_statistics()const;
+
+         /// @return the statistics of all pools of the process
+         static std::vector<object_pool_statistics> get_all_statistics();
+
+         /**
+          * @return the pool of blocks of the size of @p T, named after @p Tag and @p kind
+          * @note Pools are never destroyed, since objects may be freed by destructors of other static objects
+          */
+         template<typename Tag, typename T>
+         static object_pool& instance( const char* kind )
+         {
+            static object_pool* pool = create( boost::core::demangle( typeid(Tag).name() ) + " " + kind,
+                                               sizeof(T) );
+            return *pool;
+         }
+
+      private:
+         object_pool( std::string name, size_t node_size );
+
+         /// Creates a pool and registers it for @ref get_all_statistics
+         static object_pool* create( std::string name, size_t node_size );
+
+         /// Number of blocks per slab, so that a slab of a small object spans a few pages
+         static constexpr size_t nodes_per_slab = 256;
+
+         struct free_node { free_node* next; };
+
+         const std::string            _name;
+         const size_t                 _node_size;
+         mutable std::mutex           _mutex;
+         std::vector< std::unique_ptr<char[]> > _slabs;
+         free_node*                   _free_list = nullptr;
+         uint64_t                     _nodes_in_use = 0;
+         uint64_t                     _nodes_free = 0;
+   };
+
+   /**
+    * @brief An allocator which takes single elements from an @ref object_pool
+    *
+    * It is meant for the nodes of multi_index_container, which are allocated one at a time. Arrays, e.g. the
+    * buckets of hashed indices, are allocated by the global operator new.
+    *
+    * @tparam Tag the type which names the pool, usually the object type stored in the container
+    */
+   template<typename T, typename Tag = T>
+   class pool_allocator
+   {
+      public:
+         using value_type      = T;
+         using pointer         = T*;
+         using const_pointer   = const T*;
+         using reference       = T&;
+         using const_reference = const T&;
+         using size_type       = size_t;
+         using difference_type = std::ptrdiff_t;
+
+         template<typename U>
+         struct rebind { using other = pool_allocator<U, Tag>; };
+
+         pool_allocator() = default;
+         template<typename U>
+         pool_allocator( const pool_allocator<U, Tag>& ) {}
+
+         T* allocate( size_t n )
+         {
+            if( 1 == n )
+               return static_cast<T*>( object_pool::instance<Tag, T>( "index nodes" ).allocate() );
+            return static_cast<T*>( ::operator new( n * sizeof(T) ) );
+         }
+
+         void deallocate( T* p, size_t n )
+         {
+            if( 1 == n )
+               object_pool::instance<Tag, T>( "index nodes" ).deallocate( p );
+            else
+               ::operator delete( p );
+         }
+
+         template<typename U>
+         bool operator==( const pool_allocator<U, Tag>& )const { return true; }
+         template<typename U>
+         bool operator!=( const pool_allocator<U, Tag>& )const { return false; }
+   };
+
+   /**
+    * @brief Gives a class an operator new and delete which take its instances from an @ref object_pool
+    *
+    * Instances of derived classes with a different size are allocated by the global operators.
+    */
+   template<typename DerivedClass>
+   class pool_allocated
+   {
+      public:
+         static void* operator new( size_t size )
+         {
+            if( sizeof(DerivedClass) == size )
+               return object_pool::instance<DerivedClass, DerivedClass>( "copies" ).allocate();
+            return ::operator new( size );
+         }
+
+         static void operator delete( void* p, size_t size )
+         {
+            if( sizeof(DerivedClass) == size )
+               object_pool::instance<DerivedClass, DerivedClass>( "copies" ).deallocate( p );
+            else
+               ::operator delete( p );
+         }
+
+         // The class specific operators above hide the global placement new, which containers rely on
+         static void* operator new( size_t, void* p ) noexcept { return p; }
+         static void operator delete( void*, void* ) noexcept {}
+   };
+
+} } // graphene::db
+
+FC_REFLECT( graphene::db::object_pool_statistics, (name)(node_size)(nodes_in_use)(nodes_free)(bytes_reserved) )
@@ -40,7 +40,7 @@ namespace graphene { namespace db {
       public:
          using object_type = T;
 
-         virtual const object&  create( const std::function<void(object&)>& constructor ) override
+         virtual const object&  create( object_callback constructor ) override
          {
              auto id = get_next_id();
              auto instance = id.instance();
@@ -53,12 +53,18 @@ namespace graphene { namespace db {
              return *_objects[instance];
          }
 
-         virtual void modify( const object& obj, const std::function<void(object&)>& modify_callback ) override
+         virtual void modify( const object& obj, object_callback modify_callback ) override
          {
             assert( obj.id.instance() < _objects.size() );
             modify_callback( *_objects[obj.id.instance()] );
          }
 
+         virtual void modify( const object& obj, object_callback modify_callback,
+                              modified_fields_type fields ) override
+         {
+            simple_index::modify( obj, modify_callback );
+         }
+
          virtual const object& insert( object&& obj )override
          {
             auto instance = obj.id.instance();
@@ -25,7 +25,15 @@
 #include <graphene/db/index.hpp>
 #include <graphene/db/object_database.hpp>
 
+#include <atomic>
+
 namespace graphene { namespace db {
+   size_t detail::next_secondary_index_type_number()
+   {
+      static std::atomic<size_t> next_number( 0 );
+      return next_number++;
+   }
+
    void base_primary_index::save_undo( const object& obj )
    { _db.save_undo( obj ); }
 
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <graphene/db/object_pool.hpp>
+
+#include <algorithm>
+
+namespace graphene { namespace db {
+
+namespace {
+
+   struct pool_registry
+   {
+      std::mutex                 mutex;
+      std::vector<object_pool*>  pools;
+   };
+
+   pool_registry& get_registry()
+   {
+      static pool_registry* registry = new pool_registry(); // never destroyed, like the pools
+      return *registry;
+   }
+
+} // anonymous namespace
+
+object_pool::object_pool( std::string name, size_t node_size )
+: _name( std::move(name) ),
+  // every block must be able to hold a free list link and be suitably aligned for any object
+  _node_size( ( std::max( node_size, sizeof(free_node) ) + alignof(std::max_align_t) - 1 )
+              / alignof(std::max_align_t) * alignof(std::max_align_t) )
+{ // Nothing else to do
+}
+
+object_pool* object_pool::create( std::string name, size_t node_size )
+{
+   auto* pool = new object_pool( std::move(name), node_size );
+   auto& registry = get_registry();
+   std::lock_guard<std::mutex> guard( registry.mutex );
+   registry.pools.push_back( pool );
+   return pool;
+}
+
+void* object_pool::allocate()
+{
+   std::lock_guard<std::mutex> guard( _mutex );
+   if( nullptr == _free_list )
+   {
+      _slabs.emplace_back( new char[ _node_size * nodes_per_slab ] );
+      char* slab = _slabs.back().get();
+      for( size_t i = nodes_per_slab; i > 0; --i )
+      {
+         auto* node = reinterpret_cast<free_node*>( slab + ( i - 1 ) * _node_size );
+         node->next = _free_list;
+         _free_list = node;
+      }
+      _nodes_free += nodes_per_slab;
+   }
+   free_node* node = _free_list;
+   _free_list = node->next;
+   --_nodes_free;
+   ++_nodes_in_use;
+   return node;
+}
+
+void object_pool::deallocate( void* p )
+{
+   if( nullptr == p )
+      return;
+   std::lock_guard<std::mutex> guard( _mutex );
+   auto* node = static_cast<free_node*>( p );
+   node->next = _free_list;
+   _free_list = node;
+   ++_nodes_free;
+   --_nodes_in_use;
+}
+
+object_pool_statistics object_pool::get_statistics()const
+{
+   object_pool_statistics result;
+   result.name = _name;
+   result.node_size = static_cast<uint32_t>( _node_size );
+   std::lock_guard<std::mutex> guard( _mutex );
+   result.nodes_in_use = _nodes_in_use;
+   result.nodes_free = _nodes_free;
+   result.bytes_reserved = uint64_t( _slabs.size() ) * _node_size * nodes_per_slab;
+   return result;
+}
+
+std::vector<object_pool_statistics> object_pool::get_all_statistics()
+{
+   std::vector<object_pool*> pools;
+   {
+      auto& registry = get_registry();
+      std::lock_guard<std::mutex> guard( registry.mutex );
+      pools = registry.pools;
+   }
+   std::vector<object_pool_statistics> result;
+   result.reserve( pools.size() );
+   for( const auto* pool : pools )
+      result.push_back( pool->get_statistics() );
+   std::sort( result.begin(), result.end(), []( const object_pool_statistics& a, const object_pool_statistics& b ) {
+      return a.name < b.name;
+   });
+   return result;
+}
+
+} } // graphene::db
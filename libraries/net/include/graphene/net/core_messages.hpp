@@ -43,6 +43,8 @@ namespace graphene { namespace net {
   using graphene::protocol::block_id_type;
   using graphene::protocol::transaction_id_type;
   using graphene::protocol::signed_block;
+  using graphene::protocol::precomputable_block;
+  using graphene::protocol::precomputable_block_ptr;
 
   typedef fc::ecc::public_key_data node_id_t;
   typedef fc::ripemd160 item_hash_t;
@@ -107,10 +109,13 @@ namespace graphene { namespace net {
 
       block_message(){}
       block_message(const signed_block& blk )
-      :block(blk),block_id(blk.id()){}
+      :block(std::make_shared<const precomputable_block>(blk)),block_id(blk.id()){}
+      block_message(precomputable_block_ptr blk )
+      :block(std::move(blk)),block_id(block->id()){}
 
-      signed_block    block;
-      block_id_type   block_id;
+      /// shared with the fork database and the block database rather than copied, see @ref precomputable_block
+      precomputable_block_ptr block;
+      block_id_type           block_id;
 
    };
 
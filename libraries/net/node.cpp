@@ -2961,7 +2961,7 @@ namespace graphene { namespace net { namespace detail {
         std::vector<message_hash_type> contained_transaction_msg_ids;
         _delegate->handle_block(block_message_to_send, true, contained_transaction_msg_ids);
         dlog("Successfully pushed sync block ${num} (id:${id})",
-             ("num", block_message_to_send.block.block_num())
+             ("num", block_message_to_send.block->block_num())
              ("id", block_message_to_send.block_id));
         _most_recent_blocks_accepted.push_back(block_message_to_send.block_id);
 
@@ -2971,7 +2971,7 @@ namespace graphene { namespace net { namespace detail {
       {
         wlog("Failed to push sync block ${num} (id:${id}): block is on a fork older than our undo history would "
              "allow us to switch to: ${e}",
-             ("num", block_message_to_send.block.block_num())
+             ("num", block_message_to_send.block->block_num())
              ("id", block_message_to_send.block_id)
              ("e", (fc::exception)e));
         handle_message_exception = e;
@@ -2983,7 +2983,7 @@ namespace graphene { namespace net { namespace detail {
       }
       catch (const fc::exception& e)
       {
-        auto block_num = block_message_to_send.block.block_num();
+        auto block_num = block_message_to_send.block->block_num();
         wlog("Failed to push sync block ${num} (id:${id}): client rejected sync block sent by peer: ${e}",
              ("num", block_num)
              ("id", block_message_to_send.block_id)
@@ -2991,7 +2991,7 @@ namespace graphene { namespace net { namespace detail {
         if( e.code() == block_timestamp_in_future_exception::code_enum::code_value )
         {
            handle_message_exception = block_timestamp_in_future_exception( FC_LOG_MESSAGE( warn, "",
-                ("block_header", static_cast<graphene::protocol::block_header>(block_message_to_send.block))
+                ("block_header", static_cast<graphene::protocol::block_header>(*block_message_to_send.block))
                 ("block_num", block_num)
                 ("block_id", block_message_to_send.block_id) ) );
         }
@@ -3010,7 +3010,7 @@ namespace graphene { namespace net { namespace detail {
          --_total_num_of_unfetched_items;
          dlog("sync: client accpted the block, we now have only ${count} items left to fetch before we're in sync",
                ("count", _total_num_of_unfetched_items));
-         bool is_fork_block = is_hard_fork_block(block_message_to_send.block.block_num());
+         bool is_fork_block = is_hard_fork_block(block_message_to_send.block->block_num());
          {
             fc::scoped_lock<fc::mutex> lock(_active_connections.get_mutex());
 
@@ -3025,13 +3025,13 @@ namespace graphene { namespace net { namespace detail {
                   {
                      uint32_t next_fork_block_number = get_next_known_hard_fork_block_number(peer->last_known_fork_block_number);
                      if (next_fork_block_number != 0 &&
-                           next_fork_block_number <= block_message_to_send.block.block_num())
+                           next_fork_block_number <= block_message_to_send.block->block_num())
                      {
                         std::ostringstream disconnect_reason_stream;
-                        disconnect_reason_stream << "You need to upgrade your client due to hard fork at block " << block_message_to_send.block.block_num();
+                        disconnect_reason_stream << "You need to upgrade your client due to hard fork at block " << block_message_to_send.block->block_num();
                         peers_to_disconnect[peer] = std::make_pair(disconnect_reason_stream.str(),
                               fc::oexception(fc::exception(FC_LOG_MESSAGE(error, "You need to upgrade your client due to hard fork at block ${block_number}",
-                              ("block_number", block_message_to_send.block.block_num())))));
+                              ("block_number", block_message_to_send.block->block_num())))));
 #ifdef ENABLE_DEBUG_ULOGS
                         ulog("Disconnecting from peer during sync because their version is too old.  Their version date: ${date}", ("date", peer->graphene_git_revision_unix_timestamp));
 #endif
@@ -3063,7 +3063,7 @@ namespace graphene { namespace net { namespace detail {
                   if (items_being_processed_iter != peer->ids_of_items_being_processed.end())
                   {
                      peer->last_block_delegate_has_seen = block_message_to_send.block_id;
-                     peer->last_block_time_delegate_has_seen = block_message_to_send.block.timestamp;
+                     peer->last_block_time_delegate_has_seen = block_message_to_send.block->timestamp;
 
                      peer->ids_of_items_being_processed.erase(items_being_processed_iter);
                      dlog("Removed item from ${endpoint}'s list of items being processed, still processing ${len} blocks",
@@ -3327,7 +3327,7 @@ namespace graphene { namespace net { namespace detail {
           _delegate->handle_block(block_message_to_process, false, contained_transaction_msg_ids);
           message_validated_time = fc::time_point::now();
           dlog("Successfully pushed block ${num} (id:${id})",
-                ("num", block_message_to_process.block.block_num())
+                ("num", block_message_to_process.block->block_num())
                 ("id", block_message_to_process.block_id));
           _most_recent_blocks_accepted.push_back(block_message_to_process.block_id);
 
@@ -3356,8 +3356,8 @@ namespace graphene { namespace net { namespace detail {
         dlog( "client validated the block, advertising it to other peers" );
 
         item_id block_message_item_id(core_message_type_enum::block_message_type, message_hash);
-        uint32_t block_number = block_message_to_process.block.block_num();
-        fc::time_point_sec block_time = block_message_to_process.block.timestamp;
+        uint32_t block_number = block_message_to_process.block->block_num();
+        fc::time_point_sec block_time = block_message_to_process.block->timestamp;
         {
          fc::scoped_lock<fc::mutex> lock(_active_connections.get_mutex());
          for (const peer_connection_ptr& peer : _active_connections)
@@ -3421,7 +3421,7 @@ namespace graphene { namespace net { namespace detail {
       catch (const fc::exception& e)
       {
         // client rejected the block.  Disconnect the client and any other clients that offered us this block
-        auto block_num = block_message_to_process.block.block_num();
+        auto block_num = block_message_to_process.block->block_num();
         wlog("Failed to push block ${num} (id:${id}), client rejected block sent by peer: ${e}",
               ("num", block_num)
               ("id", block_message_to_process.block_id)
@@ -3430,7 +3430,7 @@ namespace graphene { namespace net { namespace detail {
         if( e.code() == block_timestamp_in_future_exception::code_enum::code_value )
         {
            disconnect_exception = block_timestamp_in_future_exception( FC_LOG_MESSAGE( warn, "",
-                ("block_header", static_cast<graphene::protocol::block_header>(block_message_to_process.block))
+                ("block_header", static_cast<graphene::protocol::block_header>(*block_message_to_process.block))
                 ("block_num", block_num)
                 ("block_id", block_message_to_process.block_id) ) );
         }
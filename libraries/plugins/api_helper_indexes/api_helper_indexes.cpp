@@ -189,8 +189,7 @@ void api_helper_indexes::plugin_startup()
       amount_in_collateral_idx->object_inserted( call );
 
    auto& account_members = *database().add_secondary_index< primary_index<account_index>, account_member_index >();
-   for( const auto& account : database().get_index_type< account_index >().indices() )
-      account_members.object_inserted( account );
+   account_members.bulk_insert( database().get_index_type< account_index >().indices() );
 
    auto& approvals = *database().add_secondary_index< primary_index<proposal_index>, required_approval_index >();
    for( const auto& proposal : database().get_index_type< proposal_index >().indices() )
@@ -30,6 +30,10 @@
 #include <fc/network/http/websocket.hpp>
 #include <fc/rpc/websocket_api.hpp>
 #include <fc/api.hpp>
+#include <fc/io/raw.hpp>
+#include <fc/thread/parallel.hpp>
+
+#include <deque>
 
 namespace graphene { namespace delayed_node {
 namespace bpo = boost::program_options;
@@ -43,6 +47,12 @@ struct delayed_node_plugin_impl {
    boost::signals2::scoped_connection client_connection_closed;
    graphene::chain::block_id_type last_received_remote_head;
    graphene::chain::block_id_type last_processed_remote_head;
+   /// Number of blocks requested at once while syncing, 0 to request them one by one
+   uint32_t batch_size = 100;
+   /// Maximum number of batches requested but not pushed yet
+   uint16_t pipeline_depth = 4;
+   fc::future<void> mainloop_done;
+   fc::future<void> reconnect_done;
 };
 }
 
@@ -59,6 +69,11 @@ void delayed_node_plugin::plugin_set_program_options(bpo::options_description& c
    cli.add_options()
          ("trusted-node", boost::program_options::value<std::string>(),
           "RPC endpoint of a trusted validating node (required for delayed_node)")
+         ("trusted-node-batch-size", boost::program_options::value<uint32_t>()->default_value(100),
+          "Number of packed blocks requested from the trusted node at once while syncing, "
+          "0 to request blocks one by one")
+         ("trusted-node-pipeline-depth", boost::program_options::value<uint16_t>()->default_value(4),
+          "Maximum number of batches of blocks requested ahead of the local head while syncing")
          ;
    cfg.add(cli);
 }
@@ -93,6 +108,11 @@ void delayed_node_plugin::plugin_initialize(const boost::program_options::variab
    FC_ASSERT(options.count("trusted-node") > 0);
    my = std::make_unique<detail::delayed_node_plugin_impl>();
    my->remote_endpoint = "ws://" + options.at("trusted-node").as<std::string>();
+   if( options.count("trusted-node-batch-size") > 0 )
+      my->batch_size = options.at("trusted-node-batch-size").as<uint32_t>();
+   if( options.count("trusted-node-pipeline-depth") > 0 )
+      my->pipeline_depth = options.at("trusted-node-pipeline-depth").as<uint16_t>();
+   FC_ASSERT( my->pipeline_depth > 0, "trusted-node-pipeline-depth must be greater than 0" );
 }
 
 void delayed_node_plugin::sync_with_trusted_node()
@@ -116,6 +136,23 @@ void delayed_node_plugin::sync_with_trusted_node()
          break;
       }
       pass_count++;
+      if( my->batch_size > 0 )
+      {
+         try
+         {
+            synced_blocks += sync_in_batches( remote_dpo.last_irreversible_block_num );
+            continue;
+         }
+         catch( const fc::exception& e )
+         {
+            // Other errors, e.g. a lost connection, are retried with the next block notification
+            if( !is_missing_remote_method( e ) )
+               throw;
+            wlog( "Trusted node does not support fetching packed blocks, falling back to fetching blocks one by one: "
+                  "${e}", ("e", e.to_detail_string()) );
+            my->batch_size = 0;
+         }
+      }
       while( remote_dpo.last_irreversible_block_num > db.head_block_num() )
       {
          fc::optional<graphene::chain::signed_block> block = my->database_api->get_block( db.head_block_num()+1 );
@@ -129,6 +166,92 @@ void delayed_node_plugin::sync_with_trusted_node()
    }
 }
 
+uint32_t delayed_node_plugin::sync_in_batches( uint32_t last_block_num )
+{
+   auto& db = database();
+   uint32_t synced_blocks = 0;
+   uint32_t next_block_num = db.head_block_num() + 1;
+   // Batches being fetched and unpacked while earlier ones are being pushed
+   std::deque<fc::future<std::vector<graphene::protocol::precomputable_block_ptr>>> pending_batches;
+   while( next_block_num <= last_block_num || !pending_batches.empty() )
+   {
+      while( pending_batches.size() < my->pipeline_depth && next_block_num <= last_block_num )
+      {
+         const uint32_t count = std::min( my->batch_size, last_block_num - next_block_num + 1 );
+         pending_batches.push_back( fc::async( [this, next_block_num, count]() {
+            return fetch_blocks( next_block_num, count );
+         }, "delayed_node fetch_blocks" ) );
+         next_block_num += count;
+      }
+
+      const auto blocks = pending_batches.front().wait();
+      pending_batches.pop_front();
+
+      // Verify signatures of the whole batch on the thread pool while pushing the blocks one by one
+      std::vector<fc::future<void>> precomputed;
+      precomputed.reserve( blocks.size() );
+      try
+      {
+         for( const auto& block : blocks )
+            precomputed.push_back( db.precompute_parallel( *block, graphene::chain::database::skip_nothing ) );
+         for( size_t i = 0; i < blocks.size(); ++i )
+         {
+            FC_ASSERT( blocks[i]->block_num() == db.head_block_num() + 1,
+                       "Trusted node returned block #${n} instead of #${e}",
+                       ("n", blocks[i]->block_num())("e", db.head_block_num() + 1) );
+            precomputed[i].wait();
+            db.push_block( blocks[i] );
+            synced_blocks++;
+         }
+      }
+      catch( ... )
+      {
+         // Wait for the rest before unwinding, they refer to the blocks
+         for( auto& item : precomputed )
+         {
+            try { item.wait(); } catch( ... ) { }
+         }
+         throw;
+      }
+      ilog( "Pushed blocks up to #${n}", ("n", db.head_block_num()) );
+   }
+   return synced_blocks;
+}
+
+bool delayed_node_plugin::is_missing_remote_method( const fc::exception& e )
+{
+   // The API server rejects calls of unknown methods with this message
+   return e.to_detail_string().find( "no method with name" ) != std::string::npos;
+}
+
+std::vector<graphene::protocol::precomputable_block_ptr> delayed_node_plugin::fetch_blocks(
+      uint32_t first_block_num, uint32_t count )const
+{
+   std::vector<std::vector<char>> packed_blocks;
+   packed_blocks.reserve( count );
+   // The trusted node may return fewer blocks than requested due to its response size limit
+   while( packed_blocks.size() < count )
+   {
+      const uint32_t block_num = first_block_num + static_cast<uint32_t>( packed_blocks.size() );
+      graphene::app::raw_block_range range = my->database_api->get_raw_blocks(
+                                                   block_num, count - static_cast<uint32_t>( packed_blocks.size() ) );
+      FC_ASSERT( range.first_block_num == block_num && !range.blocks.empty(),
+                 "Trusted node claims it has blocks it doesn't actually have." );
+      std::move( range.blocks.begin(), range.blocks.end(), std::back_inserter( packed_blocks ) );
+   }
+   if( packed_blocks.size() > count )
+      packed_blocks.resize( count );
+
+   return fc::do_parallel( [&packed_blocks]() {
+      std::vector<graphene::protocol::precomputable_block_ptr> blocks;
+      blocks.reserve( packed_blocks.size() );
+      for( const auto& packed : packed_blocks )
+         blocks.push_back( std::make_shared<const graphene::protocol::precomputable_block>(
+                                 fc::raw::unpack<graphene::protocol::signed_block>( packed ) ) );
+      return blocks;
+   } ).wait();
+}
+
 void delayed_node_plugin::mainloop()
 {
    while( true )
@@ -143,6 +266,10 @@ void delayed_node_plugin::mainloop()
          sync_with_trusted_node();
          my->last_processed_remote_head = my->last_received_remote_head;
       }
+      catch( const fc::canceled_exception& )
+      {
+         throw;
+      }
       catch( const fc::exception& e )
       {
          elog("Error during connection: ${e}", ("e", e.to_detail_string()));
@@ -152,19 +279,40 @@ void delayed_node_plugin::mainloop()
 
 void delayed_node_plugin::plugin_startup()
 {
-   fc::async([this]()
+   my->mainloop_done = fc::async([this]()
    {
       mainloop();
-   });
+   }, "delayed_node mainloop");
 
    connect();
 }
 
+void delayed_node_plugin::plugin_shutdown()
+{
+   if( my->mainloop_done.valid() )
+   {
+      try
+      {
+         my->mainloop_done.cancel_and_wait( "delayed_node_plugin::plugin_shutdown()" );
+      }
+      catch( const fc::exception& e )
+      {
+         wlog( "Caught exception while stopping the delayed node: ${e}", ("e", e.to_detail_string()) );
+      }
+   }
+   if( my->reconnect_done.valid() && !my->reconnect_done.ready() )
+      my->reconnect_done.cancel( "delayed_node_plugin::plugin_shutdown()" );
+   // Do not reconnect when the connection is closed
+   my->client_connection_closed.disconnect();
+   my->client_connection.reset();
+}
+
 void delayed_node_plugin::connection_failed()
 {
    my->last_received_remote_head = my->last_processed_remote_head;
    elog("Connection to trusted node failed; retrying in 5 seconds...");
-   fc::schedule([this]{connect();}, fc::time_point::now() + fc::seconds(5));
+   my->reconnect_done = fc::schedule([this]{connect();}, fc::time_point::now() + fc::seconds(5),
+                                     "delayed_node reconnect");
 }
 
 } }
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <graphene/app/plugin.hpp>
+#include <graphene/protocol/block.hpp>
 
 namespace graphene { namespace delayed_node {
 namespace detail { struct delayed_node_plugin_impl; }
@@ -40,12 +41,25 @@ public:
                                    boost::program_options::options_description& cfg) override;
    void plugin_initialize(const boost::program_options::variables_map& options) override;
    void plugin_startup() override;
+   void plugin_shutdown() override;
    void mainloop();
 
+   /// @return whether @p e is the error of calling a method which the trusted node does not provide,
+   ///         E.G. @ref graphene::app::database_api::get_raw_blocks on an older node
+   static bool is_missing_remote_method( const fc::exception& e );
+
 protected:
    void connection_failed();
    void connect();
    void sync_with_trusted_node();
+
+private:
+   /// Push the blocks up to @p last_block_num, requesting batches of packed blocks ahead of the local head
+   /// @return the number of blocks pushed
+   uint32_t sync_in_batches( uint32_t last_block_num );
+   /// Fetch @p count packed blocks starting from @p first_block_num, and unpack them on the thread pool
+   std::vector<graphene::protocol::precomputable_block_ptr> fetch_blocks( uint32_t first_block_num,
+                                                                          uint32_t count )const;
 };
 
 } } //graphene::account_history
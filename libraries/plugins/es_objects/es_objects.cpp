@@ -34,6 +34,11 @@
 #include <graphene/utilities/elasticsearch.hpp>
 #include <graphene/utilities/boost_program_options.hpp>
 
+#include <fc/io/json.hpp>
+#include <fc/thread/thread.hpp>
+
+#include <deque>
+
 namespace graphene { namespace db {
    template<uint8_t SpaceID, uint8_t TypeID>
    constexpr uint16_t object_id<SpaceID, TypeID>::space_type;
@@ -90,6 +95,11 @@ class es_objects_plugin_impl
          uint32_t start_es_after_block = 0;
          bool sync_db_on_startup = false;
 
+         /// Number of threads serializing and sending objects to ES when loading data from the object database
+         uint16_t sync_threads = 4;
+         /// Maximum number of bulk requests being prepared or sent at the same time when loading data
+         uint16_t sync_max_in_flight = 8;
+
          void init(const boost::program_options::variables_map& options);
       };
 
@@ -110,8 +120,10 @@ class es_objects_plugin_impl
       { index_database( ids, action_type::deletion ); }
 
       void index_database(const vector<object_id_type>& ids, action_type action);
-      /// Load all data from the object database into ES
+      /// Load all data from the object database into ES, resuming an interrupted load if possible
       void sync_db( bool delete_before_load = false );
+      /// Path of the file which tracks the progress of @ref sync_db
+      fc::path sync_progress_file()const;
       /// Delete one object from ES
       void delete_from_database( const object_id_type& id, const plugin_options::object_options& opt );
       /// Delete all objects of the specified type from ES
@@ -136,20 +148,74 @@ class es_objects_plugin_impl
 
       template<typename T>
       void prepareTemplate( const T& blockchain_object, const plugin_options::object_options& opt );
+      /// Append the bulk lines to insert or update the object in ES to @p lines, thread safe
+      template<typename T>
+      size_t prepare_bulk_lines( const T& blockchain_object, const plugin_options::object_options& opt,
+                                 vector<std::string>& lines )const;
 
       void init_program_options(const boost::program_options::variables_map& options);
 
       void send_bulk_if_ready( bool force = false );
 };
 
+/// Progress of loading data from the object database into ES, to be able to resume after an interruption
+struct sync_progress
+{
+   /// Head block number of the chain state being loaded
+   uint32_t block_num = 0;
+   /// Head block ID of the chain state being loaded, differs from the saved one after a fork switch
+   graphene::chain::block_id_type block_id;
+   std::string index_prefix;
+   /// For each ES index, the instance of the first object which is not yet loaded
+   flat_map<std::string, uint64_t> next_instances;
+};
+
+} } } // graphene::es_objects::detail
+
+FC_REFLECT( graphene::es_objects::detail::sync_progress, (block_num)(block_id)(index_prefix)(next_instances) )
+
+namespace graphene { namespace es_objects { namespace detail {
+
+/**
+ * Loads objects into ES in parallel.
+ *
+ * Objects of each type are split into chunks by ID. Worker threads serialize the chunks into bulk requests
+ * and send them to ES concurrently, each with its own ES client. Other fibers of the main thread may modify
+ * the database while the loader waits for the workers, so the workers look up and serialize the objects while
+ * holding @ref graphene::chain::database::read_lock, and release it before sending. The number of chunks being processed is
+ * bounded, and the progress is saved as chunks complete in ID order, so that an interrupted load can be
+ * resumed if the chain state has not changed meanwhile.
+ */
 struct data_loader
 {
+   struct worker
+   {
+      worker( const std::string& name, const std::string& es_url, const std::string& es_auth )
+      : thread( name ), es( es_url, es_auth )
+      { }
+
+      fc::thread                    thread;
+      graphene::utilities::es_client es;
+   };
+
    es_objects_plugin_impl* my;
    graphene::chain::database &db;
+   sync_progress progress;
+   vector<std::unique_ptr<worker>> workers;
+
+   data_loader( es_objects_plugin_impl* _my, sync_progress&& _progress )
+   : my(_my), db( my->_self.database() ), progress( std::move(_progress) )
+   {
+      const uint16_t num_threads = std::max<uint16_t>( my->_options.sync_threads, 1 );
+      workers.reserve( num_threads );
+      for( uint16_t i = 0; i < num_threads; ++i )
+         workers.emplace_back( std::make_unique<worker>( "es_objects sync " + std::to_string(i),
+                                                         my->_options.elasticsearch_url, my->_options.auth ) );
+   }
 
-   explicit data_loader( es_objects_plugin_impl* _my )
-   : my(_my), db( my->_self.database() )
-   { // Nothing to do
+   void save_progress()const
+   {
+      fc::json::save_to_file( progress, my->sync_progress_file() );
    }
 
    template<typename ObjType>
@@ -159,23 +225,110 @@ struct data_loader
       if( !opt.enabled )
          return;
 
+      auto& next_instance = progress.next_instances[opt.index_name];
+      if( next_instance > 0 )
+         ilog( "Resuming loading data into index ${i} from instance ${n}",
+               ("i",my->_options.index_prefix + opt.index_name)("n",next_instance) );
       // If no_delete or store_updates is true, do not delete
-      if( force_delete || !( opt.no_delete || opt.store_updates ) )
+      else if( force_delete || !( opt.no_delete || opt.store_updates ) )
       {
          ilog( "Deleting all data in index " + my->_options.index_prefix + opt.index_name );
          my->delete_all_from_database( opt );
       }
 
       ilog( "Loading data into index " + my->_options.index_prefix + opt.index_name );
+      // Objects are visited in ID order
+      vector<uint64_t> instances;
       db.get_index( ObjType::space_id, ObjType::type_id ).inspect_all_objects(
-            [this, &opt](const graphene::db::object &o) {
-         my->prepareTemplate( static_cast<const ObjType&>(o), opt );
+            [&instances,next_instance](const graphene::db::object &o) {
+         if( o.id.instance() >= next_instance )
+            instances.push_back( o.id.instance() );
       });
-      my->send_bulk_if_ready(true);
+
+      const size_t chunk_size = std::max<uint32_t>( my->_options.bulk_replay, 1 );
+      const size_t max_in_flight = std::max<uint16_t>( my->_options.sync_max_in_flight, 1 );
+      std::deque< std::pair< fc::future<size_t>, uint64_t > > in_flight; // chunks and their next instances
+      size_t next_worker = 0;
+
+      const auto complete_oldest_chunk = [this,&in_flight,&next_instance]() {
+         my->docs_sent_batch += in_flight.front().first.wait();
+         next_instance = in_flight.front().second;
+         in_flight.pop_front();
+         save_progress();
+      };
+
+      try
+      {
+         for( size_t begin = 0; begin < instances.size(); begin += chunk_size )
+         {
+            const size_t end = std::min( begin + chunk_size, instances.size() );
+            while( in_flight.size() >= max_in_flight )
+               complete_oldest_chunk();
+            worker& w = *workers[next_worker];
+            next_worker = ( next_worker + 1 ) % workers.size();
+            in_flight.emplace_back( w.thread.async( [this,&w,&instances,&opt,begin,end]() {
+               return send_objects<ObjType>( w, instances, begin, end, opt );
+            }, "es_objects sync" ), instances[end - 1] + 1 );
+         }
+         while( !in_flight.empty() )
+            complete_oldest_chunk();
+      }
+      catch( ... )
+      {
+         // Wait for the rest before unwinding, they refer to local data
+         for( auto& item : in_flight )
+         {
+            try { item.first.wait(); } catch( ... ) { }
+         }
+         throw;
+      }
+
+      my->docs_sent_total += my->docs_sent_batch;
+      ilog( "Sent ${n} lines of bulk data to index ${i}, total ${t}",
+            ("n",my->docs_sent_batch)("i",my->_options.index_prefix + opt.index_name)("t",my->docs_sent_total) );
       my->docs_sent_batch = 0;
    }
+
+   /// Serialize the objects with the instances in [begin, end) and send them to ES, runs in a worker thread
+   /// @return the number of bulk lines sent
+   template<typename ObjType>
+   size_t send_objects( worker& w, const vector<uint64_t>& instances, size_t begin, size_t end,
+                        const es_objects_plugin_impl::plugin_options::object_options& opt )const
+   {
+      size_t sent = 0;
+      vector<std::string> lines;
+      size_t i = begin;
+      while( i < end )
+      {
+         size_t approximate_size = 0;
+         {
+            auto lock = db.read_lock();
+            for( ; i < end && approximate_size < graphene::utilities::es_client::request_size_threshold; ++i )
+            {
+               // Objects removed meanwhile are skipped, their removal is sent to ES by on_objects_delete()
+               const graphene::db::object* obj = db.find_object(
+                     object_id_type( ObjType::space_id, ObjType::type_id, instances[i] ) );
+               if( obj != nullptr )
+                  approximate_size += my->prepare_bulk_lines( static_cast<const ObjType&>( *obj ), opt, lines );
+            }
+         }
+         if( lines.empty() )
+            continue;
+         if( !w.es.send_bulk( lines ) )
+            FC_THROW_EXCEPTION( graphene::chain::plugin_exception,
+                                "Error sending ${n} lines of bulk data to ElasticSearch", ("n",lines.size()) );
+         sent += lines.size();
+         lines.clear();
+      }
+      return sent;
+   }
 };
 
+fc::path es_objects_plugin_impl::sync_progress_file()const
+{
+   return _self.database().get_data_dir() / "es_objects_sync_progress.json";
+}
+
 void es_objects_plugin_impl::sync_db( bool delete_before_load )
 {
    ilog("elasticsearch OBJECTS: loading data from the object database (chain state)");
@@ -185,7 +338,29 @@ void es_objects_plugin_impl::sync_db( bool delete_before_load )
    block_number = db.head_block_num();
    block_time = db.head_block_time();
 
-   data_loader loader( this );
+   // Resume an interrupted load only if the chain state and the target are the same
+   sync_progress progress;
+   const fc::path progress_file = sync_progress_file();
+   if( fc::exists( progress_file ) )
+   {
+      try
+      {
+         auto saved = fc::json::from_file( progress_file ).as<sync_progress>( 3 );
+         if( saved.block_num == block_number && saved.block_id == db.head_block_id()
+               && saved.index_prefix == _options.index_prefix )
+            progress = std::move( saved );
+      }
+      catch( const fc::exception& e )
+      {
+         wlog( "Unable to read ${f}, loading all data: ${e}", ("f",progress_file.string())("e",e.to_detail_string()) );
+      }
+   }
+   progress.block_num = block_number;
+   progress.block_id = db.head_block_id();
+   progress.index_prefix = _options.index_prefix;
+
+   data_loader loader( this, std::move(progress) );
+   loader.save_progress();
 
    loader.load<account_object             >( _options.accounts,       delete_before_load );
    loader.load<asset_object               >( _options.assets,         delete_before_load );
@@ -195,6 +370,8 @@ void es_objects_plugin_impl::sync_db( bool delete_before_load )
    loader.load<limit_order_object         >( _options.limit_orders,   delete_before_load );
    loader.load<budget_record_object       >( _options.budget,         delete_before_load );
 
+   fc::remove( progress_file );
+
    ilog("elasticsearch OBJECTS: done loading data from the object database (chain state)");
 }
 
@@ -303,6 +480,16 @@ void es_objects_plugin_impl::delete_all_from_database( const plugin_options::obj
 template<typename T>
 void es_objects_plugin_impl::prepareTemplate(
       const T& blockchain_object, const es_objects_plugin_impl::plugin_options::object_options& opt )
+{
+   approximate_bulk_size += prepare_bulk_lines( blockchain_object, opt, bulk_lines );
+
+   send_bulk_if_ready();
+}
+
+template<typename T>
+size_t es_objects_plugin_impl::prepare_bulk_lines(
+      const T& blockchain_object, const es_objects_plugin_impl::plugin_options::object_options& opt,
+      vector<std::string>& lines )const
 {
    fc::mutable_variant_object bulk_header;
    bulk_header["_index"] = _options.index_prefix + opt.index_name;
@@ -325,11 +512,9 @@ void es_objects_plugin_impl::prepareTemplate(
    string data = fc::json::to_string(o, fc::json::legacy_generator);
 
    auto prepare = graphene::utilities::createBulk(bulk_header, std::move(data));
-   std::move(prepare.begin(), prepare.end(), std::back_inserter(bulk_lines));
+   std::move(prepare.begin(), prepare.end(), std::back_inserter(lines));
 
-   approximate_bulk_size += bulk_lines.back().size();
-
-   send_bulk_if_ready();
+   return lines.back().size();
 }
 
 void es_objects_plugin_impl::send_bulk_if_ready( bool force )
@@ -436,7 +621,7 @@ void es_objects_plugin::plugin_set_program_options(
                "(false)")
 
          ("es-objects-asset-bitasset", boost::program_options::value<bool>(),
-               "Store bitasset data, including price feeds (true)")
+               "Store bitasset data, excluding price feeds (true)")
          ("es-objects-asset-bitasset-store-updates", boost::program_options::value<bool>(),
                "Store all updates to the bitasset data (false)")
 
@@ -454,6 +639,12 @@ void es_objects_plugin::plugin_set_program_options(
                "Start doing ES job after block(0)")
          ("es-objects-sync-db-on-startup", boost::program_options::value<bool>(),
                "Copy all applicable objects from the object database (chain state) to ES on program startup (false)")
+         ("es-objects-sync-threads", boost::program_options::value<uint16_t>(),
+               "Number of threads to serialize and send objects to ES when copying objects from the object database, "
+               "an interrupted copy is resumed on the next startup if the chain state has not changed (4)")
+         ("es-objects-sync-max-in-flight", boost::program_options::value<uint16_t>(),
+               "Maximum number of bulk requests being prepared or sent at the same time "
+               "when copying objects from the object database (8)")
          ;
    cfg.add(cli);
 }
@@ -494,6 +685,8 @@ void detail::es_objects_plugin_impl::plugin_options::init(const boost::program_o
    utilities::get_program_option( options, "es-objects-max-mapping-depth",    max_mapping_depth );
    utilities::get_program_option( options, "es-objects-start-es-after-block", start_es_after_block );
    utilities::get_program_option( options, "es-objects-sync-db-on-startup",   sync_db_on_startup );
+   utilities::get_program_option( options, "es-objects-sync-threads",         sync_threads );
+   utilities::get_program_option( options, "es-objects-sync-max-in-flight",   sync_max_in_flight );
 }
 
 void es_objects_plugin::plugin_initialize(const boost::program_options::variables_map& options)
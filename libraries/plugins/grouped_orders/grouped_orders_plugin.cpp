@@ -26,11 +26,15 @@
 
 #include <graphene/chain/market_object.hpp>
 
+#include <mutex>
+
 namespace graphene { namespace grouped_orders {
 
 namespace detail
 {
 
+class limit_order_group_index;
+
 class grouped_orders_plugin_impl
 {
    public:
@@ -42,8 +46,18 @@ class grouped_orders_plugin_impl
          return _self.database();
       }
 
+      /// Rebuilds the snapshots of the markets whose orders have changed since the last call
+      void update_depth_snapshots();
+
+      using depth_key_type = std::tuple< uint16_t, asset_id_type, asset_id_type >; ///< group, base, quote
+
       grouped_orders_plugin&     _self;
       flat_set<uint16_t>         _tracked_groups;
+      limit_order_group_index*   _group_index = nullptr;
+
+      /// Guards @ref _depth_snapshots, which is read by API threads
+      mutable std::mutex         _depth_snapshots_mutex;
+      map< depth_key_type, std::shared_ptr<const limit_order_group_depth> > _depth_snapshots;
 };
 
 /**
@@ -65,9 +79,25 @@ class limit_order_group_index : public secondary_index
       const map< limit_order_group_key, limit_order_group_data >& get_order_groups() const
       { return _og_data; }
 
+      using market_type = std::pair< asset_id_type, asset_id_type >;
+
+      /// @return the markets whose groups have changed since the last call
+      flat_set< market_type > take_changed_markets()
+      {
+         flat_set< market_type > result;
+         std::swap( result, _changed_markets );
+         return result;
+      }
+
    private:
       void remove_order( const limit_order_object& obj, bool remove_empty = true );
 
+      void mark_changed( const limit_order_object& o )
+      { _changed_markets.emplace( o.sell_price.base.asset_id, o.sell_price.quote.asset_id ); }
+
+      /** markets whose groups have changed, I.E. whose snapshots need to be rebuilt */
+      flat_set< market_type > _changed_markets;
+
       /** tracked groups */
       flat_set<uint16_t> _tracked_groups;
 
@@ -78,6 +108,7 @@ class limit_order_group_index : public secondary_index
 void limit_order_group_index::object_inserted( const object& objct )
 { try {
    const limit_order_object& o = static_cast<const limit_order_object&>( objct );
+   mark_changed( o );
 
    auto& idx = _og_data;
 
@@ -205,6 +236,8 @@ void limit_order_group_index::object_modified( const object& objct )
 
 void limit_order_group_index::remove_order( const limit_order_object& o, bool remove_empty )
 {
+   mark_changed( o );
+
    auto& idx = _og_data;
 
    for( uint16_t group : get_tracked_groups() )
@@ -234,6 +267,35 @@ void limit_order_group_index::remove_order( const limit_order_object& o, bool re
    }
 }
 
+void grouped_orders_plugin_impl::update_depth_snapshots()
+{
+   if( _group_index == nullptr )
+      return;
+
+   const auto& og_data = _group_index->get_order_groups();
+   for( const auto& market : _group_index->take_changed_markets() )
+   {
+      price max_price = price::max( market.first, market.second );
+      price min_price = price::min( market.first, market.second );
+      for( uint16_t group : _tracked_groups )
+      {
+         auto itr = og_data.lower_bound( limit_order_group_key( group, max_price ) );
+         auto end = og_data.upper_bound( limit_order_group_key( group, min_price ) );
+         // build the snapshot without holding the lock
+         std::shared_ptr<const limit_order_group_depth> depth;
+         if( itr != end )
+            depth = std::make_shared<limit_order_group_depth>( itr, end );
+
+         depth_key_type key( group, market.first, market.second );
+         std::lock_guard<std::mutex> guard( _depth_snapshots_mutex );
+         if( depth )
+            _depth_snapshots[ key ] = std::move( depth );
+         else
+            _depth_snapshots.erase( key );
+      }
+   }
+}
+
 } // end namespace detail
 
 
@@ -283,6 +345,10 @@ void grouped_orders_plugin::plugin_startup()
                                                    detail::limit_order_group_index >( my->_tracked_groups );
    for( const auto& order : database().get_index_type< limit_order_index >().indices() )
       groups.object_inserted( order );
+
+   my->_group_index = &groups;
+   my->update_depth_snapshots();
+   database().applied_block.connect( [this]( const signed_block& ){ my->update_depth_snapshots(); } );
 }
 
 const flat_set<uint16_t>& grouped_orders_plugin::tracked_groups() const
@@ -298,4 +364,14 @@ const map< limit_order_group_key, limit_order_group_data >& grouped_orders_plugi
    return logidx.get_order_groups();
 }
 
+std::shared_ptr<const limit_order_group_depth> grouped_orders_plugin::get_limit_order_group_depth(
+      uint16_t group, const asset_id_type& base, const asset_id_type& quote )const
+{
+   std::lock_guard<std::mutex> guard( my->_depth_snapshots_mutex );
+   auto itr = my->_depth_snapshots.find( std::make_tuple( group, base, quote ) );
+   if( itr == my->_depth_snapshots.end() )
+      return nullptr;
+   return itr->second;
+}
+
 } }
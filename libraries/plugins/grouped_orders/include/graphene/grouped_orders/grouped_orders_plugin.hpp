@@ -57,6 +57,12 @@ struct limit_order_group_data
    share_type    total_for_sale; ///< asset id is min_price.base.asset_id
 };
 
+/**
+ *  A snapshot of the groups of one group size in one market (one side of an order book),
+ *  ordered by price descendingly, the same as in @ref limit_order_groups.
+ */
+using limit_order_group_depth = vector< std::pair< limit_order_group_key, limit_order_group_data > >;
+
 namespace detail
 {
     class grouped_orders_plugin_impl;
@@ -84,6 +90,21 @@ class grouped_orders_plugin : public graphene::app::plugin
 
       const map< limit_order_group_key, limit_order_group_data >& limit_order_groups();
 
+      /**
+       *  @brief Get the groups of a market as of the last applied block.
+       *
+       *  The snapshots are updated after each block for the markets whose orders have changed, and can be read
+       *  from any thread without locking the database.
+       *
+       *  @param group the group size
+       *  @param base the asset for sale in the orders
+       *  @param quote the asset to receive in the orders
+       *  @return the snapshot, or null if the group size is not tracked or there is no order in the market
+       */
+      std::shared_ptr<const limit_order_group_depth> get_limit_order_group_depth( uint16_t group,
+                                                                                  const asset_id_type& base,
+                                                                                  const asset_id_type& quote )const;
+
    private:
       std::unique_ptr<detail::grouped_orders_plugin_impl> my;
 };
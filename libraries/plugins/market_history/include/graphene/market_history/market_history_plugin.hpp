@@ -32,6 +32,9 @@
 
 #include <boost/multi_index/composite_key.hpp>
 
+#include <deque>
+#include <map>
+
 namespace graphene { namespace market_history {
 using namespace chain;
 
@@ -119,22 +122,6 @@ struct order_history_object : public abstract_object<order_history_object,
    fc::time_point_sec   time;
    fill_order_operation op;
 };
-struct order_history_object_key_base_extractor
-{
-   using result_type = asset_id_type;
-   result_type operator()(const order_history_object& o)const { return o.key.base; }
-};
-struct order_history_object_key_quote_extractor
-{
-   using result_type = asset_id_type;
-   result_type operator()(const order_history_object& o)const { return o.key.quote; }
-};
-struct order_history_object_key_sequence_extractor
-{
-   using result_type = int64_t;
-   result_type operator()(const order_history_object& o)const { return o.key.sequence; }
-};
-
 struct market_ticker_object : public abstract_object<market_ticker_object,
                                         MARKET_HISTORY_SPACE_ID, market_ticker_object_type>
 {
@@ -164,28 +151,11 @@ using bucket_object_multi_index_type = multi_index_container<
    >
 >;
 
-struct by_market_time;
 using order_history_multi_index_type = multi_index_container<
    order_history_object,
    indexed_by<
       ordered_unique< tag<by_id>, member< object, object_id_type, &object::id > >,
-      ordered_unique< tag<by_key>, member< order_history_object, history_key, &order_history_object::key > >,
-      ordered_unique<
-         tag<by_market_time>,
-         composite_key<
-            order_history_object,
-            order_history_object_key_base_extractor,
-            order_history_object_key_quote_extractor,
-            member<order_history_object, time_point_sec, &order_history_object::time>,
-            order_history_object_key_sequence_extractor
-         >,
-         composite_key_compare<
-            std::less< asset_id_type >,
-            std::less< asset_id_type >,
-            std::greater< time_point_sec >,
-            std::less< int64_t >
-         >
-      >
+      ordered_unique< tag<by_key>, member< order_history_object, history_key, &order_history_object::key > >
    >
 >;
 
@@ -212,6 +182,34 @@ using bucket_index = generic_index<bucket_object, bucket_object_multi_index_type
 using history_index = generic_index<order_history_object, order_history_multi_index_type>;
 using market_ticker_index = generic_index<market_ticker_object, market_ticker_obj_mlti_idx_type>;
 
+/**
+ *  @brief This secondary index keeps the fill order histories of each market in an append-only log.
+ *
+ *  The histories of a market are ordered by sequence, I.E. newest first, the same order as in the @ref by_key
+ *  index. New records are added to the front and old records are pruned from the back, both in constant time.
+ *  Since the time of the records is non-increasing in this order, a log can be searched by time or by sequence
+ *  with a binary search, without an extra ordered index on time.
+ */
+class market_trade_log_index : public secondary_index
+{
+   public:
+      using market_log = std::deque< const order_history_object* >;
+
+      void object_inserted( const object& obj ) override;
+      void object_removed( const object& obj ) override;
+
+      /// @return the log of the market, or @c nullptr if there is no history in the market
+      const market_log* get_market_log( const asset_id_type& base, const asset_id_type& quote )const;
+
+      /// @return the first record in the log whose time is not later than @p t
+      static market_log::const_iterator lower_bound_by_time( const market_log& log, const fc::time_point_sec& t );
+      /// @return the first record in the log whose sequence is not less than @p sequence
+      static market_log::const_iterator lower_bound_by_sequence( const market_log& log, int64_t sequence );
+
+   private:
+      std::map< std::pair<asset_id_type, asset_id_type>, market_log > _logs;
+};
+
 
 /** Stores operation histories related to liquidity pools */
 struct liquidity_pool_history_object : public abstract_object<liquidity_pool_history_object,
@@ -87,9 +87,8 @@ struct operation_process_fill_order
    {
       //ilog( "processing ${o}", ("o",o) );
       auto& db         = _plugin.database();
-      const auto& order_his_idx = db.get_index_type<history_index>().indices();
-      const auto& history_idx = order_his_idx.get<by_key>();
-      const auto& his_time_idx = order_his_idx.get<by_market_time>();
+      const auto& trade_logs = db.get_index_type< primary_index< history_index > >()
+                                 .get_secondary_index< market_trade_log_index >();
 
       // To save new filled order data
       history_key hkey;
@@ -97,12 +96,10 @@ struct operation_process_fill_order
       hkey.quote = o.receives.asset_id;
       if( hkey.base > hkey.quote )
          std::swap( hkey.base, hkey.quote );
-      hkey.sequence = std::numeric_limits<int64_t>::min();
 
-      auto itr = history_idx.lower_bound( hkey );
-
-      if( itr != history_idx.end() && itr->key.base == hkey.base && itr->key.quote == hkey.quote )
-         hkey.sequence = itr->key.sequence - 1;
+      const auto* log = trade_logs.get_market_log( hkey.base, hkey.quote );
+      if( log != nullptr )
+         hkey.sequence = log->front()->key.sequence - 1;
       else
          hkey.sequence = 0;
 
@@ -125,37 +122,21 @@ struct operation_process_fill_order
             _meta = &( *meta_idx.begin() );
       }
 
-      // To remove old filled order data
+      // To remove old filled order data, which is neither in the latest records nor in the latest seconds
+      log = trade_logs.get_market_log( hkey.base, hkey.quote );
       const auto max_records = _plugin.max_order_his_records_per_market();
-      hkey.sequence += max_records;
-      itr = history_idx.lower_bound( hkey );
-      if( itr != history_idx.end() && itr->key.base == hkey.base && itr->key.quote == hkey.quote )
+      if( log->size() > max_records )
       {
          const auto max_seconds = _plugin.max_order_his_seconds_per_market();
          fc::time_point_sec min_time;
          if( min_time + max_seconds < _now )
             min_time = _now - max_seconds;
-         auto time_itr = his_time_idx.lower_bound( std::make_tuple( hkey.base, hkey.quote, min_time ) );
-         if( time_itr != his_time_idx.end() && time_itr->key.base == hkey.base && time_itr->key.quote == hkey.quote )
+         auto to_remove = log->size() - max_records;
+         // Records are removed from the back of the log, so it is not empty until the loop ends
+         while( to_remove > 0 && log->back()->time <= min_time )
          {
-            if( itr->key.sequence >= time_itr->key.sequence )
-            {
-               while( itr != history_idx.end() && itr->key.base == hkey.base && itr->key.quote == hkey.quote )
-               {
-                  auto old_itr = itr;
-                  ++itr;
-                  db.remove( *old_itr );
-               }
-            }
-            else
-            {
-               while( time_itr != his_time_idx.end() && time_itr->key.base == hkey.base && time_itr->key.quote == hkey.quote )
-               {
-                  auto old_itr = time_itr;
-                  ++time_itr;
-                  db.remove( *old_itr );
-               }
-            }
+            db.remove( *log->back() );
+            --to_remove;
          }
       }
 
@@ -212,38 +193,16 @@ struct operation_process_fill_order
       const auto& buckets = _plugin.tracked_buckets();
       if( buckets.size() == 0 ) return;
 
-      const auto& bucket_idx = db.get_index_type<bucket_index>();
+      const auto& by_key_idx = db.get_index_type<bucket_index>().indices().get<by_key>();
       for( auto bucket : buckets )
       {
           auto bucket_num = _now.sec_since_epoch() / bucket;
-          fc::time_point_sec cutoff;
-          if( bucket_num > max_history )
-             cutoff = cutoff + ( bucket * ( bucket_num - max_history ) );
 
           key.seconds = bucket;
           key.open    = fc::time_point_sec() + ( bucket_num * bucket );
 
-          const auto& by_key_idx = bucket_idx.indices().get<by_key>();
           auto bucket_itr = by_key_idx.find( key );
-          if( bucket_itr == by_key_idx.end() )
-          { // create new bucket
-            /* const auto& obj = */
-            db.create<bucket_object>( [&]( bucket_object& b ){
-                 b.key = key;
-                 b.base_volume = trade_price.base.amount;
-                 b.quote_volume = trade_price.quote.amount;
-                 b.open_base = fill_price.base.amount;
-                 b.open_quote = fill_price.quote.amount;
-                 b.close_base = fill_price.base.amount;
-                 b.close_quote = fill_price.quote.amount;
-                 b.high_base = b.close_base;
-                 b.high_quote = b.close_quote;
-                 b.low_base = b.close_base;
-                 b.low_quote = b.close_quote;
-            });
-            //wlog( "    creating bucket ${b}", ("b",obj) );
-          }
-          else
+          if( bucket_itr != by_key_idx.end() )
           { // update existing bucket
              //wlog( "    before updating bucket ${b}", ("b",*bucket_itr) );
              db.modify( *bucket_itr, [&]( bucket_object& b ){
@@ -271,17 +230,45 @@ struct operation_process_fill_order
                   }
              });
              //wlog( "    after bucket bucket ${b}", ("b",*bucket_itr) );
+             // Expired buckets have been removed when this bucket was opened
+             continue;
           }
 
-          {
-             key.open = fc::time_point_sec();
-             bucket_itr = by_key_idx.lower_bound( key );
+          fc::time_point_sec cutoff;
+          if( bucket_num > max_history )
+             cutoff = cutoff + ( bucket * ( bucket_num - max_history ) );
 
-             while( bucket_itr != by_key_idx.end() &&
-                    bucket_itr->key.base == key.base &&
-                    bucket_itr->key.quote == key.quote &&
-                    bucket_itr->key.seconds == bucket &&
-                    bucket_itr->key.open < cutoff )
+          const auto init_bucket = [&]( bucket_object& b ){
+               b.key = key;
+               b.base_volume = trade_price.base.amount;
+               b.quote_volume = trade_price.quote.amount;
+               b.open_base = fill_price.base.amount;
+               b.open_quote = fill_price.quote.amount;
+               b.close_base = fill_price.base.amount;
+               b.close_quote = fill_price.quote.amount;
+               b.high_base = b.close_base;
+               b.high_quote = b.close_quote;
+               b.low_base = b.close_base;
+               b.low_quote = b.close_quote;
+          };
+
+          // The buckets of a market and a bucket size are used as a ring:
+          // when a new bucket is opened, the oldest bucket is reused if it has expired
+          const auto is_expired = [&by_key_idx,&key,&cutoff]( const decltype(bucket_itr)& itr ) {
+             return ( itr != by_key_idx.end() &&
+                      itr->key.base == key.base &&
+                      itr->key.quote == key.quote &&
+                      itr->key.seconds == key.seconds &&
+                      itr->key.open < cutoff );
+          };
+          bucket_itr = by_key_idx.lower_bound( bucket_key( key.base, key.quote, bucket, fc::time_point_sec() ) );
+          if( is_expired( bucket_itr ) )
+          { // reuse the oldest bucket
+             const bucket_object& oldest_bucket = *bucket_itr;
+             ++bucket_itr;
+             db.modify( oldest_bucket, init_bucket );
+             // Remove other expired buckets, E.G. if max_history has been reduced
+             while( is_expired( bucket_itr ) )
              {
               //  elog( "    removing old bucket ${b}", ("b", *bucket_itr) );
                 auto old_bucket_itr = bucket_itr;
@@ -289,6 +276,12 @@ struct operation_process_fill_order
                 db.remove( *old_bucket_itr );
              }
           }
+          else
+          { // create new bucket
+            /* const auto& obj = */
+            db.create<bucket_object>( init_bucket );
+            //wlog( "    creating bucket ${b}", ("b",obj) );
+          }
       }
    }
 };
@@ -770,6 +763,7 @@ void market_history_plugin::plugin_initialize(const boost::program_options::vari
 
    database().add_index< primary_index< bucket_index  > >();
    database().add_index< primary_index< history_index  > >();
+   database().add_secondary_index< primary_index< history_index >, market_trade_log_index >();
    database().add_index< primary_index< market_ticker_index, 8 > >(); // 256 markets per chunk
    database().add_index< primary_index< simple_index< market_ticker_meta_object > > >();
 
@@ -815,4 +809,60 @@ uint32_t market_history_plugin::max_order_his_seconds_per_market()const
    return my->_max_order_his_seconds_per_market;
 }
 
+void market_trade_log_index::object_inserted( const object& obj )
+{
+   const auto& o = static_cast<const order_history_object&>( obj );
+   auto& log = _logs[ std::make_pair( o.key.base, o.key.quote ) ];
+   if( log.empty() || o.key.sequence < log.front()->key.sequence )
+      log.push_front( &o );
+   else if( o.key.sequence > log.back()->key.sequence )
+      log.push_back( &o );
+   else // when undoing removals the records may be inserted out of order
+      log.insert( lower_bound_by_sequence( log, o.key.sequence ), &o );
+}
+
+void market_trade_log_index::object_removed( const object& obj )
+{
+   const auto& o = static_cast<const order_history_object&>( obj );
+   auto log_itr = _logs.find( std::make_pair( o.key.base, o.key.quote ) );
+   if( log_itr == _logs.end() )
+      return;
+   auto& log = log_itr->second;
+   if( !log.empty() && log.back() == &o )
+      log.pop_back();
+   else if( !log.empty() && log.front() == &o )
+      log.pop_front();
+   else
+   {
+      auto itr = lower_bound_by_sequence( log, o.key.sequence );
+      if( itr != log.end() && *itr == &o )
+         log.erase( itr );
+   }
+   if( log.empty() )
+      _logs.erase( log_itr );
+}
+
+const market_trade_log_index::market_log* market_trade_log_index::get_market_log( const asset_id_type& base,
+                                                                                   const asset_id_type& quote )const
+{
+   auto itr = _logs.find( std::make_pair( base, quote ) );
+   if( itr == _logs.end() )
+      return nullptr;
+   return &itr->second;
+}
+
+market_trade_log_index::market_log::const_iterator market_trade_log_index::lower_bound_by_time(
+      const market_log& log, const fc::time_point_sec& t )
+{
+   return std::partition_point( log.begin(), log.end(),
+                                [&t]( const order_history_object* o ) { return o->time > t; } );
+}
+
+market_trade_log_index::market_log::const_iterator market_trade_log_index::lower_bound_by_sequence(
+      const market_log& log, int64_t sequence )
+{
+   return std::lower_bound( log.begin(), log.end(), sequence,
+                            []( const order_history_object* o, int64_t seq ) { return o->key.sequence < seq; } );
+}
+
 } }
@@ -98,8 +98,27 @@ namespace graphene { namespace protocol {
       }
       return _calculated_merkle_root;
    }
+
+   const vector<char>& precomputable_block::get_packed()const
+   {
+      if( _packed.empty() ) // a serialized block is never empty
+         _packed = fc::raw::pack( static_cast<const signed_block&>( *this ) );
+      return _packed;
+   }
 } }
 
+namespace fc {
+   void from_variant( const fc::variant& var, graphene::protocol::precomputable_block_ptr& vo, uint32_t max_depth )
+   {
+      // The block pointed to may be shared, so never write into it, always make a new one
+      auto block = std::make_shared<graphene::protocol::precomputable_block>();
+      // Don't decrement max_depth since we're not actually deserializing at this step
+      from_variant( var, *block, max_depth );
+      vo = std::move( block );
+   }
+} // fc
+
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::protocol::block_header)
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::protocol::signed_block_header)
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::protocol::signed_block)
+GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::protocol::precomputable_block)
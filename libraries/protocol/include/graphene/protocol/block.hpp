@@ -70,12 +70,46 @@ namespace graphene { namespace protocol {
       mutable checksum_type   _calculated_merkle_root;
    };
 
+   /** This represents a signed block that will never be modified again after initial creation,
+    *  E.G. a block received from the network or one that has been generated and signed.
+    *  In addition to the ID, signee and merkle root that are cached by @ref signed_block,
+    *  it is safe to cache its serialized form, which is needed for storing it in the block database.
+    *
+    *  Instances are meant to be shared with @ref precomputable_block_ptr rather than copied.
+    */
+   class precomputable_block : public signed_block
+   {
+   public:
+      precomputable_block() = default;
+      explicit precomputable_block( const signed_block& b ) : signed_block( b ) {}
+      explicit precomputable_block( signed_block&& b ) : signed_block( std::move(b) ) {}
+
+      /// @return the serialized block, which is identical to the serialized @ref signed_block
+      const vector<char>& get_packed()const;
+      uint64_t            get_packed_size()const { return get_packed().size(); }
+   protected:
+      mutable vector<char> _packed;
+   };
+
+   using precomputable_block_ptr = std::shared_ptr<const precomputable_block>;
+
 } } // graphene::protocol
 
+namespace fc {
+template<>
+struct get_typename<graphene::protocol::precomputable_block_ptr> { static const char* name() {
+    return "shared_ptr<const precomputable_block>";
+} };
+void from_variant( const fc::variant& var, graphene::protocol::precomputable_block_ptr& vo,
+                   uint32_t max_depth = 2 );
+} // fc
+
 FC_REFLECT( graphene::protocol::block_header, (previous)(timestamp)(witness)(transaction_merkle_root)(extensions) )
 FC_REFLECT_DERIVED( graphene::protocol::signed_block_header, (graphene::protocol::block_header), (witness_signature) )
 FC_REFLECT_DERIVED( graphene::protocol::signed_block, (graphene::protocol::signed_block_header), (transactions) )
+FC_REFLECT_DERIVED( graphene::protocol::precomputable_block, (graphene::protocol::signed_block), )
 
 GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::protocol::block_header)
 GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::protocol::signed_block_header)
 GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::protocol::signed_block)
+GRAPHENE_DECLARE_EXTERNAL_SERIALIZATION( graphene::protocol::precomputable_block)
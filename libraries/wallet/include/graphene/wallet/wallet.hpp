@@ -275,9 +275,9 @@ class wallet_api
        * Market-issued assets's behavior are determined both by their "BitAsset Data" and
        * their basic asset data, as returned by \c get_asset().
        * @param asset_symbol_or_id the symbol or id of the BitAsset in question
-       * @returns the BitAsset-specific data for this asset
+       * @returns the BitAsset-specific data for this asset, including the price feeds
        */
-      asset_bitasset_data_object        get_bitasset_data( const string& asset_symbol_or_id )const;
+      extended_asset_bitasset_data_object get_bitasset_data( const string& asset_symbol_or_id )const;
 
       /**
        * Returns information about the given HTLC object.
@@ -799,6 +799,22 @@ class wallet_api
          return std::make_pair(trx.id(),trx);
       }
 
+      /**
+       *  Pay many accounts from one account, for example to process withdrawals.
+       *
+       *  The transfers are packed in order into as few transactions as the maximum transaction size allows.
+       *  Memos are encrypted and transactions are signed in parallel, and the transactions are broadcast
+       *  with a bounded number of requests in flight. Nothing is broadcast if any entry is invalid.
+       * @param from the name or id of the account sending the funds
+       * @param entries the transfers to do, see @ref bulk_transfer_entry
+       * @param broadcast true to broadcast the transactions on the network
+       * @returns one result per transaction, in the order of the entries, with the broadcast error if any,
+       *          or with the signed transaction if @p broadcast is false
+       */
+      vector<bulk_transfer_result> bulk_transfer( const string& from,
+                                                  const vector<bulk_transfer_entry>& entries,
+                                                  bool broadcast = false )const;
+
 
       /**
        *  This method is used to convert a JSON transaction to its transactin ID.
@@ -1869,6 +1885,7 @@ FC_API( graphene::wallet::wallet_api,
         (cancel_order)
         (transfer)
         (transfer2)
+        (bulk_transfer)
         (get_transaction_id)
         (create_asset)
         (update_asset)
@@ -319,6 +319,24 @@ struct account_history_operation_detail {
    vector<operation_detail_ex>  details;
 };
 
+/// One payout of @ref wallet_api::bulk_transfer
+struct bulk_transfer_entry {
+   string to;                 ///< name or ID of the receiving account
+   string amount;             ///< amount in nominal units
+   string asset_symbol_or_id;
+   string memo;               ///< encrypted for the receiver, no memo if empty
+};
+
+/// The outcome of one transaction built by @ref wallet_api::bulk_transfer
+struct bulk_transfer_result {
+   uint32_t            first_entry = 0;   ///< index of the first entry packed into the transaction
+   uint32_t            entry_count = 0;   ///< number of consecutive entries packed into the transaction
+   transaction_id_type transaction_id;
+   bool                broadcasted = false;
+   optional<string>    error;             ///< why the broadcast failed, if it did
+   optional<signed_transaction> transaction; ///< the signed transaction, if it was not to be broadcast
+};
+
 }} // namespace graphene::wallet
 
 FC_REFLECT( graphene::wallet::key_label, (label)(key) )
@@ -385,5 +403,9 @@ FC_REFLECT(graphene::wallet::operation_detail_ex,
 FC_REFLECT( graphene::wallet::account_history_operation_detail,
         (total_count)(result_count)(details))
 
+FC_REFLECT( graphene::wallet::bulk_transfer_entry, (to)(amount)(asset_symbol_or_id)(memo) )
+FC_REFLECT( graphene::wallet::bulk_transfer_result,
+            (first_entry)(entry_count)(transaction_id)(broadcasted)(error)(transaction) )
+
 FC_REFLECT( graphene::wallet::signed_message_meta, (account)(memo_key)(block)(time) )
 FC_REFLECT( graphene::wallet::signed_message, (message)(meta)(signature) )
@@ -586,11 +586,12 @@ extended_asset_object wallet_api::get_asset( const string& asset_name_or_id ) co
    return *found_asset;
 }
 
-asset_bitasset_data_object wallet_api::get_bitasset_data( const string& asset_name_or_id ) const
+extended_asset_bitasset_data_object wallet_api::get_bitasset_data( const string& asset_name_or_id ) const
 {
    auto asset = get_asset(asset_name_or_id);
    FC_ASSERT(asset.is_market_issued() && asset.bitasset_data_id);
-   return my->get_object(*asset.bitasset_data_id);
+   auto ob = my->_remote_db->get_objects( { object_id_type(*asset.bitasset_data_id) }, {} ).front();
+   return ob.as<extended_asset_bitasset_data_object>( GRAPHENE_MAX_NESTED_OBJECTS );
 }
 
 account_id_type wallet_api::get_account_id( const string& account_name_or_id ) const
@@ -797,6 +798,12 @@ signed_transaction wallet_api::transfer( const string& from, const string& to, c
 {
    return my->transfer(from, to, amount, asset_symbol, memo, broadcast);
 }
+vector<bulk_transfer_result> wallet_api::bulk_transfer( const string& from,
+                                                        const vector<bulk_transfer_entry>& entries,
+                                                        bool broadcast /* = false */ )const
+{
+   return my->bulk_transfer( from, entries, broadcast );
+}
 signed_transaction wallet_api::create_asset( const string& issuer,
                                              const string& symbol,
                                              uint8_t precision,
@@ -1175,6 +1182,13 @@ string wallet_api::gethelp( const string& method )const
       ss << "example: transfer \"1.3.11\" \"1.3.4\" 1000.03 CORE \"memo\" true\n";
       ss << "example: transfer \"usera\" \"userb\" 1000.123 CORE \"memo\" true\n";
    }
+   else if( method == "bulk_transfer" )
+   {
+      ss << "usage: bulk_transfer FROM [{\"to\":TO,\"amount\":AMOUNT,\"asset_symbol_or_id\":SYMBOL,"
+            "\"memo\":\"memo\"},...] BROADCAST\n\n";
+      ss << "example: bulk_transfer \"usera\" [{\"to\":\"userb\",\"amount\":\"1000.123\","
+            "\"asset_symbol_or_id\":\"CORE\",\"memo\":\"memo\"}] true\n";
+   }
    else if( method == "create_account_with_brain_key" )
    {
       ss << "usage: create_account_with_brain_key BRAIN_KEY ACCOUNT_NAME REGISTRAR REFERRER BROADCAST\n\n";
@@ -364,6 +364,12 @@ public:
    signed_transaction transfer(string from, string to, string amount,
          string asset_symbol, string memo, bool broadcast = false);
 
+   /// How many transactions @ref bulk_transfer broadcasts at the same time
+   static constexpr size_t max_pending_bulk_broadcasts = 16;
+
+   vector<bulk_transfer_result> bulk_transfer( const string& from, const vector<bulk_transfer_entry>& entries,
+         bool broadcast = false );
+
    signed_transaction issue_asset(string to_account, string amount, string symbol,
          string memo, bool broadcast = false);
 
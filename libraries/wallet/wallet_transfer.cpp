@@ -24,6 +24,15 @@
 #include "wallet_api_impl.hpp"
 #include <graphene/wallet/wallet.hpp>
 
+#include <fc/asio.hpp>
+#include <fc/io/raw.hpp>
+#include <fc/thread/parallel.hpp>
+
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+
 /***
  * Methods to handle transfers / exchange orders
  */
@@ -83,6 +92,225 @@ namespace graphene { namespace wallet { namespace detail {
       return sign_transaction(tx, broadcast);
    } FC_CAPTURE_AND_RETHROW( (from)(to)(amount)(asset_symbol)(memo)(broadcast) ) }
 
+   vector<bulk_transfer_result> wallet_api_impl::bulk_transfer( const string& from,
+         const vector<bulk_transfer_entry>& entries, bool broadcast )
+   { try {
+      FC_ASSERT( !self.is_locked() );
+      FC_ASSERT( !entries.empty(), "No transfer to do" );
+      FC_ASSERT( entries.size() <= std::numeric_limits<uint32_t>::max(), "Too many transfers" );
+
+      const account_object from_account = get_account( from );
+
+      // Look up every receiver and asset once instead of once per transfer
+      flat_set<string> unique_names;
+      flat_set<string> unique_symbols;
+      bool has_memo = false;
+      for( const auto& entry : entries )
+      {
+         unique_names.insert( entry.to );
+         unique_symbols.insert( entry.asset_symbol_or_id );
+         has_memo = has_memo || !entry.memo.empty();
+      }
+      const vector<string> names( unique_names.begin(), unique_names.end() );
+      const vector<string> symbols( unique_symbols.begin(), unique_symbols.end() );
+      const auto accounts = _remote_db->get_accounts( names, false );
+      const auto assets = _remote_db->get_assets( symbols, false );
+      map<string, const account_object*> receivers;
+      for( size_t i = 0; i < names.size(); ++i )
+      {
+         FC_ASSERT( accounts[i].valid(), "Could not find account matching ${a}", ("a", names[i]) );
+         receivers[names[i]] = &*accounts[i];
+      }
+      map<string, const extended_asset_object*> assets_by_symbol;
+      for( size_t i = 0; i < symbols.size(); ++i )
+      {
+         FC_ASSERT( assets[i].valid(), "Could not find asset matching ${a}", ("a", symbols[i]) );
+         assets_by_symbol[symbols[i]] = &*assets[i];
+      }
+
+      fc::ecc::private_key memo_key;
+      if( has_memo )
+         memo_key = get_private_key( from_account.options.memo_key );
+
+      const auto global_props = get_global_properties();
+      const fee_schedule& fees = global_props.parameters.get_current_fees();
+      vector<operation> ops( entries.size() );
+      for( size_t i = 0; i < entries.size(); ++i )
+      {
+         const auto& entry = entries[i];
+         transfer_operation xfer_op;
+         xfer_op.from = from_account.get_id();
+         xfer_op.to = receivers[entry.to]->get_id();
+         xfer_op.amount = assets_by_symbol[entry.asset_symbol_or_id]->amount_from_string( entry.amount );
+         ops[i] = xfer_op;
+      }
+
+      // Encrypting a memo needs an ECDH key agreement, which is by far the most expensive step of building
+      // a transfer, so the memos are encrypted by all threads. The transfer fee depends on the memo size.
+      const size_t num_threads = fc::asio::default_io_service_scope::get_num_threads();
+      const auto for_each_chunk = [num_threads]( size_t count, const std::function<void(size_t)>& f ) {
+         const size_t chunk_size = ( count + num_threads - 1 ) / num_threads;
+         std::vector<fc::future<void>> workers;
+         workers.reserve( num_threads );
+         for( size_t base = 0; base < count; base += chunk_size )
+            workers.push_back( fc::do_parallel( [&f,base,chunk_size,count] () {
+               const size_t end = std::min( base + chunk_size, count );
+               for( size_t i = base; i < end; ++i )
+                  f( i );
+            }) );
+         // wait for all workers before leaving, they refer to local variables
+         std::exception_ptr error;
+         for( auto& worker : workers )
+         {
+            try
+            {
+               worker.wait();
+            }
+            catch( ... )
+            {
+               if( !error )
+                  error = std::current_exception();
+            }
+         }
+         if( error )
+            std::rethrow_exception( error );
+      };
+      for_each_chunk( ops.size(), [&]( size_t i ) {
+         const auto& entry = entries[i];
+         auto& xfer_op = ops[i].get<transfer_operation>();
+         if( !entry.memo.empty() )
+         {
+            const public_key_type& to_memo_key = receivers.at( entry.to )->options.memo_key;
+            xfer_op.memo = memo_data();
+            xfer_op.memo->from = from_account.options.memo_key;
+            xfer_op.memo->to = to_memo_key;
+            xfer_op.memo->set_message( memo_key, to_memo_key, entry.memo );
+         }
+         fees.set_fee( ops[i] );
+         xfer_op.validate();
+      });
+
+      // All transactions need the same signatures, since they only contain transfers from the same account
+      signed_transaction sample;
+      sample.operations.push_back( ops.front() );
+      const set<public_key_type> approving_key_set = get_owned_required_keys( sample );
+      vector<fc::ecc::private_key> signing_keys;
+      signing_keys.reserve( approving_key_set.size() );
+      for( const public_key_type& key : approving_key_set )
+         signing_keys.push_back( get_private_key( key ) );
+
+      // Pack the transfers in order into transactions of at most the maximum size, leaving room for the header,
+      // the signatures and the longer encodings of the operation and signature counts
+      const size_t max_trx_size = global_props.parameters.maximum_transaction_size;
+      const size_t trx_overhead = fc::raw::pack_size( signed_transaction() ) + 8
+                                  + signing_keys.size() * fc::raw::pack_size( signature_type() );
+      FC_ASSERT( max_trx_size > trx_overhead, "Maximum transaction size is too small" );
+      vector<signed_transaction> trxs;
+      vector<bulk_transfer_result> results;
+      size_t trx_size = max_trx_size;
+      for( size_t i = 0; i < ops.size(); ++i )
+      {
+         const size_t op_size = fc::raw::pack_size( ops[i] );
+         FC_ASSERT( trx_overhead + op_size <= max_trx_size, "Transfer ${i} is too large", ("i", i) );
+         if( trx_size + op_size > max_trx_size )
+         {
+            trxs.emplace_back();
+            results.emplace_back();
+            results.back().first_entry = static_cast<uint32_t>( i );
+            trx_size = trx_overhead;
+         }
+         trxs.back().operations.push_back( std::move( ops[i] ) );
+         ++results.back().entry_count;
+         trx_size += op_size;
+      }
+
+      const auto dyn_props = get_dynamic_global_properties();
+      // The transactions are broadcast one after the other, give the last ones enough time to get there
+      const fc::time_point_sec expiration = dyn_props.time + global_props.parameters.maximum_time_until_expiration;
+      for( auto& trx : trxs )
+      {
+         trx.set_reference_block( dyn_props.head_block_id );
+         trx.set_expiration( expiration );
+         trx.validate();
+      }
+      for_each_chunk( trxs.size(), [&]( size_t i ) {
+         for( const auto& key : signing_keys )
+            trxs[i].sign( key, _chain_id );
+      });
+
+      // Same bookkeeping as sign_transaction2(), a transaction is re-signed with a later expiration
+      // if it is identical to one which was generated recently
+      fc::time_point_sec oldest_transaction_ids_to_track( dyn_props.time - fc::minutes(2) );
+      auto& by_time = _recently_generated_transactions.get<timestamp_index>();
+      by_time.erase( by_time.begin(), by_time.lower_bound( oldest_transaction_ids_to_track ) );
+      for( size_t i = 0; i < trxs.size(); ++i )
+      {
+         auto& trx = trxs[i];
+         for( uint32_t expiration_time_offset = 1;
+              _recently_generated_transactions.find( trx.id() ) != _recently_generated_transactions.end();
+              ++expiration_time_offset )
+         {
+            trx.set_expiration( expiration - fc::seconds( expiration_time_offset ) );
+            trx.clear_signatures();
+            for( const auto& key : signing_keys )
+               trx.sign( key, _chain_id );
+         }
+         recently_generated_transaction_record this_transaction_record;
+         this_transaction_record.generation_time = dyn_props.time;
+         this_transaction_record.transaction_id = trx.id();
+         _recently_generated_transactions.insert( this_transaction_record );
+         results[i].transaction_id = this_transaction_record.transaction_id;
+      }
+
+      if( !broadcast )
+      {
+         for( size_t i = 0; i < trxs.size(); ++i )
+            results[i].transaction = std::move( trxs[i] );
+         return results;
+      }
+
+      // Keep a few broadcasts in flight on the connection to the node instead of waiting for each reply
+      // before sending the next transaction. A failed broadcast does not stop the others.
+      std::deque<fc::future<void>> pending;
+      for( size_t i = 0; i < trxs.size(); ++i )
+      {
+         if( pending.size() >= max_pending_bulk_broadcasts )
+         {
+            pending.front().wait();
+            pending.pop_front();
+         }
+         pending.push_back( fc::async( [this,&trxs,&results,i] () {
+            try
+            {
+               _remote_net_broadcast->broadcast_transaction( trxs[i] );
+               results[i].broadcasted = true;
+            }
+            catch( const fc::exception& e )
+            {
+               elog( "Caught exception while broadcasting tx ${id}:  ${e}",
+                     ("id", results[i].transaction_id.str())("e", e.to_detail_string()) );
+               results[i].error = e.to_string();
+            }
+            catch( const std::exception& e )
+            {
+               elog( "Caught exception while broadcasting tx ${id}:  ${e}",
+                     ("id", results[i].transaction_id.str())("e", e.what()) );
+               results[i].error = e.what();
+            }
+            catch( ... )
+            {
+               elog( "Caught unknown exception while broadcasting tx ${id}",
+                     ("id", results[i].transaction_id.str()) );
+               results[i].error = "unknown exception";
+            }
+         }, "bulk transfer broadcast" ) );
+      }
+      for( auto& broadcast_done : pending )
+         broadcast_done.wait();
+
+      return results;
+   } FC_CAPTURE_AND_RETHROW( (from)(entries.size())(broadcast) ) }
+
    signed_transaction wallet_api_impl::htlc_create( const string& source, const string& destination,
          const string& amount, const string& asset_symbol, const string& hash_algorithm,
          const string& preimage_hash, uint32_t preimage_size,
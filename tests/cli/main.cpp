@@ -31,6 +31,7 @@
 #include <graphene/api_helper_indexes/api_helper_indexes.hpp>
 #include <graphene/market_history/market_history_plugin.hpp>
 #include <graphene/custom_operations/custom_operations_plugin.hpp>
+#include <graphene/delayed_node/delayed_node_plugin.hpp>
 #include <graphene/egenesis/egenesis.hpp>
 #include <graphene/wallet/wallet.hpp>
 #include <graphene/chain/hardfork.hpp>
@@ -701,7 +702,7 @@ BOOST_FIXTURE_TEST_CASE( mpa_tests, cli_fixture )
       {
          // Set price feed producer
          BOOST_TEST_MESSAGE("Set price feed producer");
-         asset_bitasset_data_object bob_bitasset = con.wallet_api_ptr->get_bitasset_data( "BOBCOIN" );
+         auto bob_bitasset = con.wallet_api_ptr->get_bitasset_data( "BOBCOIN" );
          BOOST_CHECK_EQUAL( bob_bitasset.feeds.size(), 0u );
 
          auto handle = con.wallet_api_ptr->begin_builder_transaction();
@@ -728,7 +729,7 @@ BOOST_FIXTURE_TEST_CASE( mpa_tests, cli_fixture )
          feed.settlement_price = price( asset(1,bobcoin.get_id()), asset(2) );
          feed.core_exchange_rate = price( asset(1,bobcoin.get_id()), asset(1) );
          con.wallet_api_ptr->publish_asset_feed( "nathan", "BOBCOIN", feed, true );
-         asset_bitasset_data_object bob_bitasset = con.wallet_api_ptr->get_bitasset_data( "BOBCOIN" );
+         auto bob_bitasset = con.wallet_api_ptr->get_bitasset_data( "BOBCOIN" );
          BOOST_CHECK( bob_bitasset.current_feed.settlement_price == feed.settlement_price );
 
          BOOST_CHECK(generate_block(app1));
@@ -1367,6 +1368,139 @@ BOOST_FIXTURE_TEST_CASE( account_history_pagination, cli_fixture )
 }
 
 
+BOOST_FIXTURE_TEST_CASE( cli_bulk_transfer, cli_fixture )
+{
+   try
+   {
+      INVOKE(create_new_account);
+
+      const uint32_t count = 100;
+      vector<graphene::wallet::bulk_transfer_entry> entries;
+      for( uint32_t i = 1; i <= count; ++i )
+         entries.push_back( { "jmjatlanta", std::to_string(i), "1.3.0", "Withdrawal " + std::to_string(i) } );
+
+      BOOST_TEST_MESSAGE("An unknown receiver fails the whole batch");
+      auto bad_entries = entries;
+      bad_entries.back().to = "nobody";
+      BOOST_CHECK_THROW( con.wallet_api_ptr->bulk_transfer( "nathan", bad_entries, true ), fc::exception );
+
+      BOOST_TEST_MESSAGE("Paying jmjatlanta in bulk");
+      auto results = con.wallet_api_ptr->bulk_transfer( "nathan", entries, true );
+      // the transfers do not fit in one transaction of the default maximum size
+      BOOST_CHECK_GT( results.size(), 1u );
+      uint32_t next_entry = 0;
+      std::set<transaction_id_type> trx_ids;
+      for( const auto& result : results )
+      {
+         BOOST_CHECK_EQUAL( result.first_entry, next_entry );
+         BOOST_CHECK_GT( result.entry_count, 0u );
+         BOOST_CHECK( result.broadcasted );
+         BOOST_CHECK( !result.error.valid() );
+         trx_ids.insert( result.transaction_id );
+         next_entry += result.entry_count;
+      }
+      BOOST_CHECK_EQUAL( next_entry, count );
+      BOOST_CHECK_EQUAL( trx_ids.size(), results.size() );
+
+      BOOST_CHECK(generate_block(app1));
+
+      std::vector<graphene::wallet::operation_detail> history =
+            con.wallet_api_ptr->get_account_history( "jmjatlanta", count + 10 );
+      BOOST_CHECK_EQUAL( count + 2, history.size() );
+      BOOST_CHECK( history.front().memo == "Withdrawal " + std::to_string(count) );
+
+      BOOST_TEST_MESSAGE("Signing transfers in bulk without broadcasting them");
+      entries.resize( 3 );
+      results = con.wallet_api_ptr->bulk_transfer( "nathan", entries, false );
+      BOOST_REQUIRE_EQUAL( results.size(), 1u );
+      BOOST_CHECK_EQUAL( results[0].entry_count, 3u );
+      BOOST_CHECK( !results[0].broadcasted );
+      BOOST_REQUIRE( results[0].transaction.valid() );
+      BOOST_CHECK( results[0].transaction->id() == results[0].transaction_id );
+      BOOST_CHECK_EQUAL( results[0].transaction->operations.size(), 3u );
+      BOOST_CHECK( !results[0].transaction->signatures.empty() );
+      con.wallet_api_ptr->broadcast_transaction( *results[0].transaction );
+
+      BOOST_CHECK(generate_block(app1));
+
+      history = con.wallet_api_ptr->get_account_history( "jmjatlanta", count + 10 );
+      BOOST_CHECK_EQUAL( count + 5, history.size() );
+   } catch( fc::exception& e ) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
+///////////////////////
+// Sync a delayed node from a trusted node, with batches of packed blocks and block by block
+///////////////////////
+BOOST_AUTO_TEST_CASE( delayed_node_sync )
+{
+   using graphene::delayed_node::delayed_node_plugin;
+   std::shared_ptr<graphene::app::application> app1;
+   try {
+      fc::temp_directory app_dir( graphene::utilities::temp_directory_path() );
+
+      int server_port_number = 0;
+      app1 = start_application(app_dir, server_port_number);
+      auto db1 = app1->chain_database();
+      for( int i = 0; i < 50; ++i )
+         BOOST_REQUIRE( generate_block(app1) );
+      BOOST_REQUIRE_GT( db1->get_dynamic_global_properties().last_irreversible_block_num, 10u );
+
+      const auto sync_delayed_node = [&]( uint32_t batch_size ) {
+         fc::temp_directory delayed_dir( graphene::utilities::temp_directory_path() );
+         auto app2 = std::make_shared<graphene::app::application>();
+         app2->register_plugin<delayed_node_plugin>(true);
+
+         auto sharable_cfg = std::make_shared<boost::program_options::variables_map>();
+         auto& cfg = *sharable_cfg;
+         fc::set_option( cfg, "trusted-node", string("127.0.0.1:") + std::to_string(server_port_number) );
+         fc::set_option( cfg, "trusted-node-batch-size", batch_size );
+         fc::set_option( cfg, "trusted-node-pipeline-depth", uint16_t(2) );
+         fc::set_option( cfg, "p2p-endpoint", string("127.0.0.1:") + std::to_string(fc::network::get_available_port()) );
+         // same genesis as the trusted node
+         fc::set_option( cfg, "genesis-json", boost::filesystem::path(app_dir.path().generic_string()) / "genesis.json" );
+         fc::set_option( cfg, "seed-nodes", string("[]") );
+         app2->initialize(delayed_dir.path(), sharable_cfg);
+         app2->startup();
+
+         auto db2 = app2->chain_database();
+         const uint32_t target = db1->get_dynamic_global_properties().last_irreversible_block_num;
+         // the delayed node syncs when it is notified of a new block
+         for( int i = 0; i < 100 && db2->head_block_num() < target; ++i )
+         {
+            BOOST_REQUIRE( generate_block(app1) );
+            fc::usleep( fc::milliseconds(200) );
+         }
+         BOOST_REQUIRE_GE( db2->head_block_num(), target );
+         BOOST_CHECK( db2->head_block_id() == db1->get_block_id_for_num( db2->head_block_num() ) );
+         // the delayed node does not go beyond the last irreversible block of the trusted node
+         BOOST_CHECK_LE( db2->head_block_num(), db1->get_dynamic_global_properties().last_irreversible_block_num );
+      };
+
+      BOOST_TEST_MESSAGE( "Syncing in batches of packed blocks" );
+      sync_delayed_node( 4 );
+      BOOST_TEST_MESSAGE( "Syncing block by block" );
+      sync_delayed_node( 0 );
+
+      BOOST_TEST_MESSAGE( "Falling back to block by block only if the trusted node lacks the batch API" );
+      try {
+         FC_ASSERT( false, "no method with name '${name}'", ("name", "get_raw_blocks") );
+      } catch( const fc::exception& e ) {
+         BOOST_CHECK( delayed_node_plugin::is_missing_remote_method( e ) );
+      }
+      try {
+         FC_THROW( "Connection closed" );
+      } catch( const fc::exception& e ) {
+         BOOST_CHECK( !delayed_node_plugin::is_missing_remote_method( e ) );
+      }
+   } catch( fc::exception& e ) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
 ///////////////////////
 // Create a multi-sig account and verify that only when all signatures are
 // signed, the transaction could be broadcast
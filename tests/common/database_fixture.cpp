@@ -429,7 +429,8 @@ std::shared_ptr<boost::program_options::variables_map> database_fixture_base::in
       fixture.app.register_plugin<graphene::account_history::account_history_plugin>(true);
    }
 
-   if(fixture.current_test_name == "elasticsearch_objects" || fixture.current_test_name == "elasticsearch_suite") {
+   if(fixture.current_test_name == "elasticsearch_objects" || fixture.current_test_name == "elasticsearch_suite"
+         || fixture.current_test_name == "elasticsearch_objects_sync") {
       fixture.app.register_plugin<graphene::es_objects::es_objects_plugin>(true);
 
       fc::set_option( options, "es-objects-elasticsearch-url", GRAPHENE_TESTING_ES_URL );
@@ -445,6 +446,13 @@ std::shared_ptr<boost::program_options::variables_map> database_fixture_base::in
       fixture.es_obj_index_prefix = string("objects-") + fc::to_string(uint64_t(rand())) + "-";
       BOOST_TEST_MESSAGE( string("ES_OBJ index prefix is ") + fixture.es_obj_index_prefix );
       fc::set_option( options, "es-objects-index-prefix", fixture.es_obj_index_prefix );
+
+      if( fixture.current_test_name == "elasticsearch_objects_sync" )
+      {
+         fc::set_option( options, "es-objects-sync-db-on-startup", true );
+         fc::set_option( options, "es-objects-sync-threads", uint16_t(4) );
+         fc::set_option( options, "es-objects-sync-max-in-flight", uint16_t(3) );
+      }
    }
 
    if( fixture.current_test_name == "asset_in_collateral"
@@ -466,6 +474,13 @@ std::shared_ptr<boost::program_options::variables_map> database_fixture_base::in
    }
 
    fc::set_option( options, "bucket-size", string("[15]") );
+   if( fixture.current_test_name == "market_history_bucket_recycling" )
+      fc::set_option( options, "history-per-size", uint32_t(3) );
+   if( fixture.current_test_name == "market_trade_log_consistency" )
+   {
+      fc::set_option( options, "max-order-his-records-per-market", uint32_t(2) );
+      fc::set_option( options, "max-order-his-seconds-per-market", uint32_t(0) );
+   }
 
    fixture.app.register_plugin<graphene::market_history::market_history_plugin>(true);
    fixture.app.register_plugin<graphene::grouped_orders::grouped_orders_plugin>(true);
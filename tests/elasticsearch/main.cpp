@@ -29,6 +29,7 @@
 
 #include <graphene/utilities/elasticsearch.hpp>
 #include <graphene/elasticsearch/elasticsearch_plugin.hpp>
+#include <graphene/es_objects/es_objects.hpp>
 
 #include "../common/init_unit_test_suite.hpp"
 #include "../common/database_fixture.hpp"
@@ -329,6 +330,87 @@ BOOST_AUTO_TEST_CASE(elasticsearch_objects) {
    }
 }
 
+BOOST_AUTO_TEST_CASE(elasticsearch_objects_sync) {
+   try {
+
+      CURL *curl; // curl handler
+      curl = curl_easy_init();
+      curl_easy_setopt(curl, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2);
+
+      graphene::utilities::ES es;
+      es.curl = curl;
+      es.elasticsearch_url = GRAPHENE_TESTING_ES_URL;
+      es.index_prefix = es_obj_index_prefix;
+
+      // Enough accounts for many chunks, which are loaded by several threads
+      for( int i = 0; i < 50; ++i )
+         create_account( "sync" + fc::to_string(uint64_t(i)) );
+      generate_block();
+
+      auto plugin = app.get_plugin<graphene::es_objects::es_objects_plugin>( "es_objects" );
+      BOOST_REQUIRE( plugin );
+      const auto& accounts = db.get_index_type<account_index>().indices();
+      const uint64_t account_count = accounts.size();
+      // Resume with the last 10 accounts, there are holes in the instances of the special accounts
+      auto tenth_last_account = accounts.rbegin();
+      std::advance( tenth_last_account, 9 );
+      const uint64_t resume_instance = tenth_last_account->id.instance();
+      const fc::path progress_file = db.get_data_dir() / "es_objects_sync_progress.json";
+
+      const auto count_accounts = [&es]( uint64_t expected ) {
+         es.endpoint = es.index_prefix + "account/_doc/_count";
+         es.query = "";
+         string total;
+         fc::wait_for( ES_WAIT_TIME,  [&]() {
+            auto res = graphene::utilities::getEndPoint(es);
+            auto j = fc::json::from_string(res);
+            if( !j.is_object() )
+               return false;
+            const auto& obj = j.get_object();
+            if( obj.find("count") == obj.end() )
+               return false;
+            total = obj["count"].as_string();
+            return (total == fc::to_string(expected));
+         });
+         return total;
+      };
+      const auto save_progress = [&]( const block_id_type& block_id, uint64_t next_account_instance ) {
+         flat_map<string, uint64_t> next_instances;
+         next_instances["account"] = next_account_instance;
+         fc::mutable_variant_object progress;
+         progress( "block_num", db.head_block_num() )
+                 ( "block_id", block_id )
+                 ( "index_prefix", es_obj_index_prefix )
+                 ( "next_instances", fc::variant( next_instances, 2 ) );
+         fc::json::save_to_file( fc::variant( progress ), progress_file );
+      };
+
+      BOOST_TEST_MESSAGE( "Loading all objects in parallel" );
+      BOOST_REQUIRE( graphene::utilities::deleteAll(es) );
+      plugin->plugin_startup();
+      BOOST_CHECK( !fc::exists( progress_file ) );
+      BOOST_CHECK_EQUAL( count_accounts( account_count ), fc::to_string( account_count ) );
+
+      BOOST_TEST_MESSAGE( "Not resuming the progress of another chain state with the same head block number" );
+      BOOST_REQUIRE( graphene::utilities::deleteAll(es) );
+      save_progress( block_id_type(), resume_instance );
+      plugin->plugin_startup();
+      BOOST_CHECK( !fc::exists( progress_file ) );
+      BOOST_CHECK_EQUAL( count_accounts( account_count ), fc::to_string( account_count ) );
+
+      BOOST_TEST_MESSAGE( "Resuming the progress of the same chain state" );
+      BOOST_REQUIRE( graphene::utilities::deleteAll(es) );
+      save_progress( db.head_block_id(), resume_instance );
+      plugin->plugin_startup();
+      BOOST_CHECK( !fc::exists( progress_file ) );
+      BOOST_CHECK_EQUAL( count_accounts( 10 ), "10" );
+   }
+   catch (fc::exception &e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
 BOOST_AUTO_TEST_CASE(elasticsearch_suite) {
    try {
 
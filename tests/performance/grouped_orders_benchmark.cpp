@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <graphene/app/api.hpp>
+#include <graphene/grouped_orders/grouped_orders_plugin.hpp>
+#include "../common/database_fixture.hpp"
+
+using namespace graphene::chain;
+
+// Measures the cost of maintaining the order groups while orders are created and cancelled,
+// the cost of publishing the snapshots after a block, and the cost of reading a grouped order book.
+BOOST_FIXTURE_TEST_CASE( grouped_orders_churn_benchmark, database_fixture )
+{
+   try
+   {
+      ACTORS( (maker) );
+
+      const uint32_t orders = 2000;
+      const uint32_t iterations = 10;
+      const uint32_t reads = 10000;
+
+      const auto& usd = create_user_issued_asset( "USD" );
+      const asset_id_type usd_id = usd.get_id();
+      issue_uia( maker, usd.amount( int64_t(orders) * 1000 ) );
+      fund( maker, asset( int64_t(orders) * iterations * 10000 ) );
+      generate_block();
+
+      using namespace std::chrono;
+
+      std::vector<limit_order_id_type> order_ids;
+      order_ids.reserve( orders );
+
+      auto start = high_resolution_clock::now();
+      for( uint32_t i = 0; i < orders; ++i )
+         order_ids.push_back( create_sell_order( maker, usd.amount(1000), asset( 1000 + i ) )->get_id() );
+      auto elapsed = duration_cast<milliseconds>( high_resolution_clock::now() - start );
+      wlog( "Created ${n} orders in ${c} ms", ("n",orders)("c",elapsed.count()) );
+      generate_block();
+
+      // Each order is cancelled and replaced by an order with another price, then the block is produced,
+      // which also publishes the snapshots of the changed market
+      milliseconds churn_time( 0 );
+      milliseconds block_time( 0 );
+      for( uint32_t j = 0; j < iterations; ++j )
+      {
+         start = high_resolution_clock::now();
+         for( uint32_t i = 0; i < orders; ++i )
+         {
+            cancel_limit_order( order_ids[i](db) );
+            order_ids[i] = create_sell_order( maker, usd.amount(1000), asset( 1000 + (i * 7 + j) % orders ) )
+                              ->get_id();
+         }
+         auto mid = high_resolution_clock::now();
+         generate_block();
+         churn_time += duration_cast<milliseconds>( mid - start );
+         block_time += duration_cast<milliseconds>( high_resolution_clock::now() - mid );
+      }
+      wlog( "Replaced ${n} orders in ${c} ms, produced ${b} blocks in ${t} ms",
+            ("n",orders * iterations)("c",churn_time.count())("b",iterations)("t",block_time.count()) );
+
+      graphene::app::orders_api orders_api( app );
+      const std::string base = std::string( usd_id );
+      const std::string quote = std::string( asset_id_type() );
+      const optional<price> no_start;
+      size_t groups = 0;
+      start = high_resolution_clock::now();
+      for( uint32_t i = 0; i < reads; ++i )
+         groups += orders_api.get_grouped_limit_orders( base, quote, 10, no_start, 100 ).size();
+      elapsed = duration_cast<milliseconds>( high_resolution_clock::now() - start );
+      wlog( "Read the grouped order book ${n} times in ${c} ms", ("n",reads)("c",elapsed.count()) );
+      BOOST_CHECK_GT( groups, 0u );
+   }
+   FC_LOG_AND_RETHROW()
+}
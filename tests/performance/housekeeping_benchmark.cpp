@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include "../common/database_fixture.hpp"
+
+using namespace graphene::chain;
+
+// Measures the cost of producing empty blocks, which is mostly the per-block housekeeping
+// (expired orders, proposals, transactions, HTLCs, feeds etc.), with few and with many objects
+// waiting for their expiration.
+BOOST_FIXTURE_TEST_CASE( housekeeping_benchmark, database_fixture )
+{
+   try
+   {
+      ACTORS( (maker) );
+
+      const uint32_t orders = 200000;
+      const uint32_t orders_per_block = 2000;
+      const uint32_t blocks = 1000;
+
+      const asset_id_type usd_id = create_user_issued_asset( "USD" ).get_id();
+      fund( maker, asset( int64_t(orders) * 100 ) );
+      generate_block();
+
+      using namespace std::chrono;
+
+      const auto measure_empty_blocks = [this,blocks]() {
+         auto start = high_resolution_clock::now();
+         for( uint32_t i = 0; i < blocks; ++i )
+            generate_block();
+         return duration_cast<microseconds>( high_resolution_clock::now() - start ).count();
+      };
+
+      auto elapsed = measure_empty_blocks();
+      wlog( "Produced ${b} empty blocks with few expiring objects in ${c} us, ${a} us per block",
+            ("b",blocks)("c",elapsed)("a",elapsed / blocks) );
+
+      // The orders expire long after the end of the test, in the order of their creation
+      const time_point_sec first_expiration = db.head_block_time() + fc::days(30);
+      auto start = high_resolution_clock::now();
+      for( uint32_t i = 0; i < orders; ++i )
+      {
+         create_sell_order( maker_id, asset(1), asset( 1, usd_id ), first_expiration + i );
+         if( (i + 1) % orders_per_block == 0 )
+            generate_block();
+      }
+      generate_block();
+      elapsed = duration_cast<microseconds>( high_resolution_clock::now() - start ).count();
+      wlog( "Created ${n} expiring orders in ${c} us", ("n",orders)("c",elapsed) );
+      BOOST_CHECK_EQUAL( db.get_index_type<limit_order_index>().indices().size(), orders );
+
+      elapsed = measure_empty_blocks();
+      wlog( "Produced ${b} empty blocks with ${n} expiring orders in ${c} us, ${a} us per block",
+            ("b",blocks)("n",orders)("c",elapsed)("a",elapsed / blocks) );
+      BOOST_CHECK_EQUAL( db.get_index_type<limit_order_index>().indices().size(), orders );
+   }
+   FC_LOG_AND_RETHROW()
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include "../common/database_fixture.hpp"
+
+using namespace graphene::chain;
+
+// Measures how many times per second an object can be modified through the object database.
+// The second run wraps the modifier into a std::function, as it was done before object_callback was used,
+// to show the cost of the type erasure.
+BOOST_FIXTURE_TEST_CASE( modify_benchmark, database_fixture )
+{
+   try
+   {
+      ACTORS( (alice) );
+      generate_block();
+
+      const uint32_t modifications = 5000000;
+      const auto& stats = alice_id(db).statistics(db);
+
+      using namespace std::chrono;
+
+      auto start = high_resolution_clock::now();
+      for( uint32_t i = 0; i < modifications; ++i )
+         db.modify( stats, [i]( account_statistics_object& s ) {
+            s.total_ops = i;
+         });
+      auto elapsed = duration_cast<milliseconds>( high_resolution_clock::now() - start );
+      wlog( "Modified an object ${n} times in ${t} ms", ("n",modifications)("t",elapsed.count()) );
+      BOOST_CHECK_EQUAL( stats.total_ops, modifications - 1 );
+
+      start = high_resolution_clock::now();
+      for( uint32_t i = 0; i < modifications; ++i )
+         db.modify( stats, std::function<void(account_statistics_object&)>( [i]( account_statistics_object& s ) {
+            s.total_ops = i + 1;
+         }));
+      elapsed = duration_cast<milliseconds>( high_resolution_clock::now() - start );
+      wlog( "Modified an object ${n} times through std::function in ${t} ms",
+            ("n",modifications)("t",elapsed.count()) );
+      BOOST_CHECK_EQUAL( stats.total_ops, modifications );
+   }
+   FC_LOG_AND_RETHROW()
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <graphene/app/database_api.hpp>
+#include "../common/database_fixture.hpp"
+
+using namespace graphene::chain;
+
+// Measures the time needed to produce blocks which create and change many objects,
+// while a growing number of API connections are subscribed to all of them.
+BOOST_FIXTURE_TEST_CASE( subscription_benchmark, database_fixture )
+{
+   try
+   {
+      ACTORS( (maker) );
+
+      const uint32_t orders = 2000;
+      const uint32_t blocks = 5;
+
+      const auto& usd = create_user_issued_asset( "USD" );
+      issue_uia( maker, usd.amount( int64_t(orders) * blocks * 100 * 1000 ) );
+      fund( maker, asset( int64_t(orders) * blocks * 100 * 10000 ) );
+      generate_block();
+
+      using namespace std::chrono;
+
+      std::vector< std::unique_ptr<graphene::app::database_api> > apis;
+      uint64_t notifications = 0;
+      for( uint32_t subscribers : { 0, 1, 10, 100 } )
+      {
+         while( apis.size() < subscribers )
+         {
+            apis.emplace_back( new graphene::app::database_api( db, &app.get_options() ) );
+            apis.back()->set_subscribe_callback( [&notifications]( const variant& ) { ++notifications; }, true );
+            apis.back()->get_full_accounts( { "maker" }, true );
+         }
+
+         milliseconds block_time( 0 );
+         for( uint32_t j = 0; j < blocks; ++j )
+         {
+            for( uint32_t i = 0; i < orders; ++i )
+               create_sell_order( maker, usd.amount(1000), asset( 1000 + i ) );
+            auto start = high_resolution_clock::now();
+            generate_block();
+            block_time += duration_cast<milliseconds>( high_resolution_clock::now() - start );
+            fc::usleep( fc::milliseconds(100) ); // let the notifications be delivered
+         }
+         wlog( "Produced ${b} blocks with ${n} new orders each for ${s} subscribers in ${t} ms",
+               ("b",blocks)("n",orders)("s",subscribers)("t",block_time.count()) );
+      }
+      BOOST_CHECK_GT( notifications, 0u );
+   }
+   FC_LOG_AND_RETHROW()
+}
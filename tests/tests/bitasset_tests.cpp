@@ -224,7 +224,7 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_on_witness_asset )
 
       BOOST_TEST_MESSAGE("Verify feed producers have not been reset");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 3ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 3ul);
    }
    {
       BOOST_TEST_MESSAGE("With underlying bitasset changed from one to another, price feeds should still be publish-able");
@@ -252,7 +252,7 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_on_witness_asset )
 
       BOOST_TEST_MESSAGE("After hardfork, 1 feed should have been erased");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 2ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 2ul);
    }
    {
       BOOST_TEST_MESSAGE("After hardfork, change underlying asset of bit_jmj from core to bit_usd");
@@ -260,7 +260,7 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_on_witness_asset )
 
       BOOST_TEST_MESSAGE("Verify feed producers have been reset");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 0ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 0ul);
    }
    {
       BOOST_TEST_MESSAGE("With underlying bitasset changed from one to another, price feeds should still be publish-able");
@@ -333,7 +333,7 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_on_non_witness_asset )
    {
       BOOST_TEST_MESSAGE("Verify feed producers are registered for JMJBIT");
       const asset_bitasset_data_object& obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(obj.feeds.size(), 3ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(obj).size(), 3ul);
       BOOST_CHECK( obj.current_feed.margin_call_params_equal( price_feed() ) );
 
       BOOST_CHECK( bit_usd_id == obj.options.short_backing_asset );
@@ -372,8 +372,8 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_on_non_witness_asset )
 
       BOOST_TEST_MESSAGE("Verify feed producers have not been reset");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 3ul);
-      for(const auto& feed : jmj_obj.feeds) {
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 3ul);
+      for(const auto& feed : db.get_bitasset_feeds(jmj_obj)) {
          BOOST_CHECK(!feed.second.second.settlement_price.is_null());
       }
    }
@@ -388,9 +388,9 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_on_non_witness_asset )
 
       BOOST_TEST_MESSAGE("Verify that the incorrect feeds have been corrected");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 3ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 3ul);
       int nan_count = 0;
-      for(const auto& feed : jmj_obj.feeds)
+      for(const auto& feed : db.get_bitasset_feeds(jmj_obj))
       {
          if (feed.second.second.settlement_price.is_null())
             nan_count++;
@@ -405,8 +405,8 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_on_non_witness_asset )
 
       BOOST_TEST_MESSAGE("Verify feed producers have been reset");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 3ul);
-      for(const auto& feed : jmj_obj.feeds)
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 3ul);
+      for(const auto& feed : db.get_bitasset_feeds(jmj_obj))
       {
          BOOST_CHECK(feed.second.second.settlement_price.is_null());
       }
@@ -1297,7 +1297,7 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_switching_to_witness_fed )
    {
       BOOST_TEST_MESSAGE("Verify feed producers are registered for JMJBIT");
       const asset_bitasset_data_object& obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(obj.feeds.size(), 3ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(obj).size(), 3ul);
       BOOST_CHECK(obj.current_feed == price_feed());
 
 
@@ -1328,9 +1328,9 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_switching_to_witness_fed )
 
       BOOST_TEST_MESSAGE("Verify feed producers have not been reset");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 3ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 3ul);
       int nan_count = 0;
-      for(const auto& feed : jmj_obj.feeds) {
+      for(const auto& feed : db.get_bitasset_feeds(jmj_obj)) {
          if(feed.second.second.settlement_price.is_null())
             ++nan_count;
       }
@@ -1346,9 +1346,9 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_switching_to_witness_fed )
 
       // we should have 2 feeds nan, 1 old feed with wrong asset, and 1 witness feed
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 4ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 4ul);
       int nan_count = 0;
-      for(const auto& feed : jmj_obj.feeds) {
+      for(const auto& feed : db.get_bitasset_feeds(jmj_obj)) {
          if ( feed.second.second.settlement_price.is_null() )
             ++nan_count;
       }
@@ -1361,8 +1361,8 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_switching_to_witness_fed )
 
       BOOST_TEST_MESSAGE("Verify that the incorrect feeds have been removed");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 1ul);
-      BOOST_CHECK( ! (*jmj_obj.feeds.begin()).second.second.settlement_price.is_null() );
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 1ul);
+      BOOST_CHECK( ! (*db.get_bitasset_feeds(jmj_obj).begin()).second.second.settlement_price.is_null() );
       // the settlement price will be NaN until 50% of price feeds are valid
       //BOOST_CHECK_EQUAL(jmj_obj.current_feed.settlement_price.to_real(), 300);
    }
@@ -1372,7 +1372,7 @@ BOOST_AUTO_TEST_CASE( reset_backing_asset_switching_to_witness_fed )
 
       BOOST_TEST_MESSAGE("Verify feed producers have been reset");
       const asset_bitasset_data_object& jmj_obj = bit_jmj_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(jmj_obj.feeds.size(), 0ul);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(jmj_obj).size(), 0ul);
    }
    {
       BOOST_TEST_MESSAGE("With underlying bitasset changed from one to another, price feeds should still be publish-able");
@@ -40,6 +40,9 @@
 
 #include <fc/crypto/digest.hpp>
 #include <fc/io/fstream.hpp>
+#include <fc/io/raw.hpp>
+
+#include <limits>
 
 #include "../common/database_fixture.hpp"
 
@@ -70,6 +73,34 @@ genesis_state_type make_genesis() {
    return genesis_state;
 }
 
+/// Packs all objects and the next object IDs of a database, so that the states of databases can be compared
+std::vector<char> pack_all_objects( const database& db )
+{
+   std::vector<char> result;
+   for( const uint8_t space_id : { uint8_t(protocol_ids), uint8_t(implementation_ids) } )
+   {
+      for( uint32_t type_id = 0; type_id <= std::numeric_limits<uint8_t>::max(); ++type_id )
+      {
+         const graphene::db::index* idx = nullptr;
+         try
+         {
+            idx = &db.get_index( space_id, uint8_t(type_id) );
+         }
+         catch( const fc::assert_exception& ) // no such index
+         {
+            continue;
+         }
+         const auto next_id = fc::raw::pack( idx->get_next_id() );
+         result.insert( result.end(), next_id.begin(), next_id.end() );
+         idx->inspect_all_objects( [&result]( const graphene::db::object& obj ) {
+            const auto packed = obj.pack();
+            result.insert( result.end(), packed.begin(), packed.end() );
+         });
+      }
+   }
+   return result;
+}
+
 BOOST_AUTO_TEST_SUITE(block_tests)
 
 BOOST_AUTO_TEST_CASE( block_database_test )
@@ -133,6 +164,48 @@ BOOST_AUTO_TEST_CASE( block_database_test )
    }
 }
 
+BOOST_AUTO_TEST_CASE( precomputable_block_test )
+{
+   try {
+      fc::temp_directory data_dir( graphene::utilities::temp_directory_path() );
+
+      block_database bdb;
+      bdb.open( data_dir.path() );
+
+      signed_block b;
+      b.witness = witness_id_type(1);
+      signed_transaction trx;
+      trx.operations.emplace_back( transfer_operation() );
+      b.transactions.emplace_back( trx );
+
+      auto shared = std::make_shared<const precomputable_block>( b );
+      BOOST_CHECK( shared->id() == b.id() );
+      BOOST_CHECK( shared->get_packed() == fc::raw::pack( b ) );
+      BOOST_CHECK_EQUAL( shared->get_packed_size(), fc::raw::pack_size( b ) );
+
+      bdb.store( shared->id(), *shared );
+      auto fetched = bdb.fetch_optional( b.id() );
+      BOOST_REQUIRE( fetched.valid() );
+      BOOST_CHECK( fc::raw::pack( *fetched ) == shared->get_packed() );
+
+      // A shared block can be converted from a variant, into a new object
+      const precomputable_block_ptr original = shared;
+      precomputable_block_ptr from_var = shared;
+      fc::from_variant( fc::variant( b, GRAPHENE_MAX_NESTED_OBJECTS ), from_var, GRAPHENE_MAX_NESTED_OBJECTS );
+      BOOST_REQUIRE( from_var );
+      BOOST_CHECK( from_var != original );
+      BOOST_CHECK( from_var->id() == b.id() );
+      BOOST_CHECK( from_var->get_packed() == shared->get_packed() );
+      precomputable_block_ptr from_null;
+      fc::from_variant( fc::variant( b, GRAPHENE_MAX_NESTED_OBJECTS ), from_null, GRAPHENE_MAX_NESTED_OBJECTS );
+      BOOST_REQUIRE( from_null );
+      BOOST_CHECK( from_null->id() == b.id() );
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
 BOOST_AUTO_TEST_CASE( generate_empty_blocks )
 {
    try {
@@ -565,6 +638,65 @@ BOOST_AUTO_TEST_CASE( out_of_order_blocks )
 }
  */
 
+BOOST_AUTO_TEST_CASE( fork_db_branch_cache )
+{
+   try {
+      fork_database fdb;
+      auto make_block = []( const signed_block& prev, uint32_t witness ) {
+         signed_block b;
+         b.previous = prev.id();
+         b.witness = witness_id_type( witness );
+         return b;
+      };
+
+      signed_block root;
+      root.witness = witness_id_type(1);
+      fdb.start_block( root );
+
+      // fork a: 5 blocks on top of root, fork b: 3 blocks on top of root
+      signed_block head_a = root;
+      for( uint32_t i = 0; i < 5; ++i )
+      {
+         head_a = make_block( head_a, 2 );
+         fdb.push_block( head_a );
+      }
+      signed_block head_b = root;
+      for( uint32_t i = 0; i < 3; ++i )
+      {
+         head_b = make_block( head_b, 3 );
+         fdb.push_block( std::make_shared<const precomputable_block>( head_b ) );
+      }
+      BOOST_REQUIRE( fdb.head() );
+      BOOST_CHECK( fdb.head()->id == head_a.id() );
+      BOOST_CHECK( fdb.fetch_block( head_b.id() )->block );
+
+      {
+         auto branches = fdb.fetch_branch_from( head_a.id(), head_b.id() );
+         BOOST_CHECK_EQUAL( branches.first.size(), 5u );
+         BOOST_CHECK_EQUAL( branches.second.size(), 3u );
+         BOOST_CHECK( branches.first.back()->previous_id() == root.id() );
+         BOOST_CHECK( branches.second.back()->previous_id() == root.id() );
+
+         // served from the cache, in both directions
+         auto again = fdb.fetch_branch_from( head_a.id(), head_b.id() );
+         BOOST_CHECK( again.first == branches.first );
+         BOOST_CHECK( again.second == branches.second );
+         auto reversed = fdb.fetch_branch_from( head_b.id(), head_a.id() );
+         BOOST_CHECK( reversed.first == branches.second );
+         BOOST_CHECK( reversed.second == branches.first );
+      } // drop our references to the fork items, the fork database is the only owner now
+
+      // pruning the common ancestor's children invalidates the cached result
+      fdb.set_max_size( 2 );
+      BOOST_CHECK( !fdb.is_known_block( root.id() ) );
+      BOOST_CHECK( fdb.is_known_block( head_b.id() ) );
+      BOOST_CHECK_THROW( fdb.fetch_branch_from( head_a.id(), head_b.id() ), fc::exception );
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
 BOOST_AUTO_TEST_CASE( undo_pending )
 {
    try {
@@ -740,6 +872,94 @@ BOOST_AUTO_TEST_CASE( duplicate_transactions )
    }
 }
 
+/// Applies blocks with and without precomputing their transactions in parallel, the states must be identical
+BOOST_AUTO_TEST_CASE( parallel_precompute_determinism )
+{
+   try {
+      fc::temp_directory dir1( graphene::utilities::temp_directory_path() ),
+                         dir2( graphene::utilities::temp_directory_path() ),
+                         dir3( graphene::utilities::temp_directory_path() );
+      database db1, // produces the blocks
+               db2, // applies the blocks after precomputing them in parallel
+               db3; // applies the blocks without precomputing them
+      db1.open( dir1.path(), make_genesis, "TEST" );
+      db2.open( dir2.path(), make_genesis, "TEST" );
+      db3.open( dir3.path(), make_genesis, "TEST" );
+
+      auto init_account_priv_key = fc::ecc::private_key::regenerate( fc::sha256::hash(string("null_key")) );
+      public_key_type init_account_pub_key = init_account_priv_key.get_public_key();
+      const auto skip_sigs = database::skip_transaction_signatures;
+
+      const auto produce_and_apply = [&]( uint32_t skip ) {
+         signed_block b = db1.generate_block( db1.get_slot_time(1), db1.get_scheduled_witness(1),
+                                              init_account_priv_key, skip );
+         // an independent copy, so that db3 does not see any caches filled in by precomputing
+         signed_block b3 = fc::raw::unpack<signed_block>( fc::raw::pack( b ) );
+         db2.precompute_parallel( b, skip ).wait();
+         PUSH_BLOCK( db2, b, skip );
+         PUSH_BLOCK( db3, b3, skip );
+         BOOST_CHECK( db2.head_block_id() == b.id() );
+         BOOST_CHECK( db3.head_block_id() == b.id() );
+         BOOST_CHECK( pack_all_objects( db2 ) == pack_all_objects( db3 ) );
+      };
+
+      // The committee account holds all funds but can not sign transactions, so the first block skips signatures
+      const graphene::db::index& account_idx = db1.get_index( protocol_ids, account_object_type );
+      const account_id_type init0_id = db1.get_index_type<account_index>().indices().get<by_name>().find( "init0" )
+                                          ->get_id();
+      account_id_type nathan_id { account_idx.get_next_id() };
+      signed_transaction trx;
+      set_expiration( db1, trx );
+      account_create_operation cop;
+      cop.registrar = init0_id;
+      cop.name = "nathan";
+      cop.owner = authority( 1, init_account_pub_key, 1 );
+      cop.active = cop.owner;
+      trx.operations.push_back( cop );
+      transfer_operation t;
+      t.to = nathan_id;
+      t.amount = asset( 1000000 );
+      trx.operations.push_back( t );
+      PUSH_TX( db1, trx, skip_sigs );
+      produce_and_apply( skip_sigs );
+
+      // Create some accounts and fund them, then transfer a lot between them, all signed
+      const uint32_t accounts = 20;
+      vector<account_id_type> account_ids;
+      for( uint32_t i = 0; i < accounts; ++i )
+      {
+         account_ids.emplace_back( account_idx.get_next_id() );
+         trx = signed_transaction();
+         set_expiration( db1, trx );
+         cop.name = "account" + fc::to_string(i);
+         trx.operations.push_back( cop );
+         t.from = nathan_id;
+         t.to = account_ids.back();
+         t.amount = asset( 10000 );
+         trx.operations.push_back( t );
+         trx.sign( init_account_priv_key, db1.get_chain_id() );
+         PUSH_TX( db1, trx, database::skip_nothing );
+      }
+      produce_and_apply( database::skip_nothing );
+
+      for( uint32_t i = 0; i < 500; ++i )
+      {
+         trx = signed_transaction();
+         set_expiration( db1, trx );
+         t.from = account_ids[ i % accounts ];
+         t.to = account_ids[ (i * 7 + 1) % accounts ];
+         t.amount = asset( 1 + i ); // keeps the transactions unique
+         trx.operations.push_back( t );
+         trx.sign( init_account_priv_key, db1.get_chain_id() );
+         PUSH_TX( db1, trx, database::skip_nothing );
+      }
+      produce_and_apply( database::skip_nothing );
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
 BOOST_AUTO_TEST_CASE( tapos )
 {
    try {
@@ -454,6 +454,76 @@ BOOST_AUTO_TEST_CASE(container_in_not_in_checks) { try {
    BOOST_CHECK(!pred(op));
 } FC_LOG_AND_RETHROW() }
 
+BOOST_AUTO_TEST_CASE(restriction_predicate_registry_tests) { try {
+   auto& registry = restriction_predicate_registry::instance();
+   const auto transfer_type = operation::tag<transfer_operation>::value;
+
+   vector<restriction> restrictions;
+   restrictions.emplace_back(member_index<transfer_operation>("to"), FUNC(eq), account_id_type(12));
+   // Use an account ID which is unlikely to be used by other tests, so that the restrictions are new
+   restrictions.emplace_back(member_index<transfer_operation>("from"), FUNC(ne), account_id_type(987654));
+
+   const auto initial_size = registry.size();
+   auto pred = registry.get(restrictions, transfer_type);
+   BOOST_CHECK_EQUAL(registry.size(), initial_size + 1);
+
+   // The same restrictions share the compiled predicate
+   auto pred2 = registry.get(restrictions, transfer_type);
+   BOOST_CHECK_EQUAL(registry.size(), initial_size + 1);
+
+   transfer_operation transfer;
+   BOOST_CHECK(pred(transfer) == false);
+   BOOST_CHECK(pred2(transfer) == false);
+   transfer.to = account_id_type(12);
+   BOOST_CHECK(pred(transfer) == true);
+   BOOST_CHECK(pred2(transfer) == true);
+
+   // Different restrictions or a different operation type get another predicate
+   restrictions.back().argument = account_id_type(987655);
+   registry.get(restrictions, transfer_type);
+   BOOST_CHECK_EQUAL(registry.size(), initial_size + 2);
+
+   vector<restriction> override_restrictions;
+   override_restrictions.emplace_back(member_index<override_transfer_operation>("to"), FUNC(eq),
+                                      account_id_type(987654));
+   registry.get(override_restrictions, operation::tag<override_transfer_operation>::value);
+   BOOST_CHECK_EQUAL(registry.size(), initial_size + 3);
+
+   // Custom authority objects get their predicates from the registry
+   custom_authority_object auth;
+   auth.operation_type = transfer_type;
+   auth.restrictions.emplace(0, restrictions.front());
+   auth.restrictions.emplace(1, restrictions.back());
+   BOOST_CHECK(auth.get_predicate()(transfer) == true);
+   BOOST_CHECK_EQUAL(registry.size(), initial_size + 3);
+
+   custom_authority_object copy = auth;
+   copy.clear_predicate_cache();
+   BOOST_CHECK(copy.get_predicate()(transfer) == true);
+   BOOST_CHECK_EQUAL(registry.size(), initial_size + 3);
+
+   // The registry is bounded, evicted predicates are compiled again when needed
+   BOOST_CHECK_EQUAL(registry.get_capacity(), restriction_predicate_registry::default_capacity);
+   registry.set_capacity(2);
+   BOOST_CHECK_LE(registry.size(), 2u);
+   registry.get(override_restrictions, operation::tag<override_transfer_operation>::value);
+   registry.get(restrictions, transfer_type);
+   restrictions.back().argument = account_id_type(987656);
+   registry.get(restrictions, transfer_type);
+   BOOST_CHECK_EQUAL(registry.size(), 2u);
+
+   registry.set_capacity(0);
+   BOOST_CHECK_EQUAL(registry.size(), 0u);
+   BOOST_CHECK(registry.get(restrictions, transfer_type)(transfer) == true);
+   BOOST_CHECK_EQUAL(registry.size(), 0u);
+   // Objects keep their predicates
+   BOOST_CHECK(auth.get_predicate()(transfer) == true);
+
+   registry.set_capacity(restriction_predicate_registry::default_capacity);
+   registry.get(restrictions, transfer_type);
+   BOOST_CHECK_EQUAL(registry.size(), 1u);
+} FC_LOG_AND_RETHROW() }
+
    /**
     * Test predicates containing logical ORs
     * Test of authorization and revocation of one account (Alice) authorizing multiple other accounts (Bob and Charlie)
@@ -24,6 +24,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <graphene/app/api_executor.hpp>
 #include <graphene/app/database_api.hpp>
 #include <graphene/chain/hardfork.hpp>
 
@@ -32,7 +33,10 @@
 
 #include "../common/database_fixture.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <random>
+#include <thread>
 
 using namespace graphene::chain;
 using namespace graphene::chain::test;
@@ -1612,6 +1616,219 @@ BOOST_AUTO_TEST_CASE( get_block_tests )
 
 } FC_LOG_AND_RETHROW() }
 
+/// Tests get_raw_blocks
+BOOST_AUTO_TEST_CASE( get_raw_blocks_tests )
+{ try {
+
+   generate_blocks( 5 );
+   ACTORS( (nathan) );
+   fund( nathan_id(db) );
+   generate_block();
+
+   uint32_t head_block_num = db.head_block_num();
+
+   graphene::app::database_api db_api1( db );
+   BOOST_CHECK_THROW( db_api1.get_raw_blocks( 1 ), fc::exception ); // no options
+
+   graphene::app::application_options opt = app.get_options();
+   opt.api_limit_get_raw_blocks = 3;
+   graphene::app::database_api db_api( db, &opt );
+
+   BOOST_CHECK_THROW( db_api.get_raw_blocks( 1, 4 ), fc::exception );
+
+   auto range = db_api.get_raw_blocks( 1 );
+   BOOST_CHECK_EQUAL( range.first_block_num, 1u );
+   BOOST_REQUIRE_EQUAL( range.blocks.size(), 3u );
+   BOOST_REQUIRE( range.next_block_num.valid() );
+   BOOST_CHECK_EQUAL( *range.next_block_num, 4u );
+   for( uint32_t i = 0; i < range.blocks.size(); ++i )
+   {
+      auto b = fc::raw::unpack<signed_block>( range.blocks[i] );
+      BOOST_CHECK_EQUAL( b.block_num(), range.first_block_num + i );
+      BOOST_CHECK( b.id() == db.fetch_block_by_number( b.block_num() )->id() );
+   }
+
+   // fetch the rest, including the head block which is still in the fork database
+   uint32_t next = *range.next_block_num;
+   uint32_t last_num = 0;
+   while( true )
+   {
+      range = db_api.get_raw_blocks( next );
+      BOOST_REQUIRE( !range.blocks.empty() );
+      last_num = fc::raw::unpack<signed_block>( range.blocks.back() ).block_num();
+      if( !range.next_block_num.valid() )
+         break;
+      next = *range.next_block_num;
+   }
+   BOOST_CHECK_EQUAL( last_num, head_block_num );
+   BOOST_CHECK( fc::raw::unpack<signed_block>( range.blocks.back() ).id() == db.head_block_id() );
+
+   range = db_api.get_raw_blocks( head_block_num + 1 );
+   BOOST_CHECK( range.blocks.empty() );
+   BOOST_CHECK( !range.next_block_num.valid() );
+
+   range = db_api.get_raw_blocks( 1, 0 );
+   BOOST_CHECK( range.blocks.empty() );
+
+} FC_LOG_AND_RETHROW() }
+
+/// Tests get_raw_objects
+BOOST_AUTO_TEST_CASE( get_raw_objects_tests )
+{ try {
+
+   ACTORS( (nathan) );
+   fund( nathan_id(db) );
+   generate_block();
+
+   graphene::app::database_api db_api( db, &( app.get_options() ) );
+
+   vector<object_id_type> ids { nathan_id, nathan_id(db).statistics, asset_id_type(), account_id_type(1000000) };
+   auto objs = db_api.get_raw_objects( ids );
+   BOOST_REQUIRE_EQUAL( objs.size(), ids.size() );
+
+   BOOST_REQUIRE( objs[0].valid() );
+   auto acct = fc::raw::unpack<account_object>( *objs[0] );
+   BOOST_CHECK( acct.id == nathan_id );
+   BOOST_CHECK_EQUAL( acct.name, "nathan" );
+
+   BOOST_REQUIRE( objs[1].valid() );
+   auto stats = fc::raw::unpack<account_statistics_object>( *objs[1] );
+   BOOST_CHECK( stats.id == nathan_id(db).statistics );
+   BOOST_CHECK( stats.owner == nathan_id );
+
+   BOOST_REQUIRE( objs[2].valid() );
+   BOOST_CHECK_EQUAL( fc::raw::unpack<asset_object>( *objs[2] ).symbol, GRAPHENE_SYMBOL );
+
+   BOOST_CHECK( !objs[3].valid() );
+
+   // same content as returned by get_objects
+   BOOST_CHECK_EQUAL( fc::json::to_string( fc::variant( acct, GRAPHENE_MAX_NESTED_OBJECTS ) ),
+                      fc::json::to_string( db_api.get_objects( { nathan_id } ).front() ) );
+
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( api_executor_tests )
+{ try {
+   using graphene::app::api_executor;
+
+   ACTORS( (alice) );
+   const auto& usd = create_user_issued_asset( "MYUSD" );
+   transfer( committee_account, alice_id, asset(10000) );
+   create_sell_order( alice_id, asset(100), usd.amount(200) );
+   generate_block();
+
+   auto executor = std::make_shared<api_executor>( "database_api", db, 2, 10 );
+   graphene::app::database_api db_api( db, &( app.get_options() ), executor );
+
+   BOOST_CHECK( !api_executor::in_worker_thread() );
+
+   // the call is executed by a worker thread
+   auto result = executor->run( [this]() {
+      return std::make_pair( api_executor::in_worker_thread(), db.head_block_num() );
+   } );
+   BOOST_CHECK( result.first );
+   BOOST_CHECK_EQUAL( result.second, db.head_block_num() );
+
+   // nested calls are executed inline by the same worker thread
+   BOOST_CHECK( executor->run( [&executor]() {
+      return executor->run( []() { return api_executor::in_worker_thread(); } );
+   } ) );
+
+   // exceptions are passed to the caller
+   GRAPHENE_CHECK_THROW( executor->run( []() -> int { FC_THROW( "Expected" ); } ), fc::exception );
+
+   // dispatched database API calls return the same results
+   BOOST_CHECK_EQUAL( db_api.get_limit_orders( "1.3.0", "MYUSD", 10 ).size(), 1u );
+   BOOST_CHECK_EQUAL( db_api.get_order_book( "1.3.0", "MYUSD", 10 ).bids.size(), 1u );
+
+   // the chain can still be modified between calls
+   generate_block();
+   BOOST_CHECK_EQUAL( executor->run( [this]() { return db.head_block_num(); } ), db.head_block_num() );
+
+   const auto stats = executor->get_stats();
+   BOOST_CHECK_EQUAL( stats.num_threads, 2u );
+   BOOST_CHECK_EQUAL( stats.executed_calls, 6u );
+   BOOST_CHECK_EQUAL( stats.rejected_calls, 0u );
+   BOOST_CHECK_EQUAL( stats.queue_depth, 0u );
+   BOOST_CHECK_EQUAL( stats.max_queue_depth, 1u );
+
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( read_write_mutex_prefers_writers )
+{ try {
+   read_write_mutex mutex;
+   std::atomic<bool> writer_done { false };
+   std::atomic<bool> second_reader_done { false };
+
+   mutex.lock_shared();
+
+   std::thread writer( [&]() {
+      mutex.lock();
+      writer_done = true;
+      std::this_thread::sleep_for( std::chrono::milliseconds(20) );
+      mutex.unlock();
+   } );
+   while( mutex.waiting_writers() == 0 )
+      std::this_thread::yield();
+
+   // A new reader has to wait for the waiting writer, although the lock is held in shared mode
+   std::thread reader( [&]() {
+      mutex.lock_shared();
+      BOOST_CHECK( writer_done );
+      second_reader_done = true;
+      mutex.unlock_shared();
+   } );
+   std::this_thread::sleep_for( std::chrono::milliseconds(50) );
+   BOOST_CHECK( !writer_done );
+   BOOST_CHECK( !second_reader_done );
+
+   mutex.unlock_shared();
+   writer.join();
+   reader.join();
+   BOOST_CHECK( writer_done );
+   BOOST_CHECK( second_reader_done );
+
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( blocks_are_applied_under_constant_reader_load )
+{ try {
+   generate_block();
+
+   // Overlapping readers, so that the database is read locked nearly all the time
+   std::atomic<bool> stop { false };
+   std::atomic<uint64_t> reads { 0 };
+   std::vector<std::thread> readers;
+   for( int i = 0; i < 4; ++i )
+   {
+      readers.emplace_back( [&,i]() {
+         std::this_thread::sleep_for( std::chrono::milliseconds( i ) );
+         while( !stop )
+         {
+            auto lock = db.read_lock();
+            if( db.head_block_num() > 0 )
+               ++reads;
+            std::this_thread::sleep_for( std::chrono::milliseconds(4) );
+         }
+      } );
+   }
+   while( reads < 10 )
+      std::this_thread::yield();
+
+   const uint32_t start_block_num = db.head_block_num();
+   const auto start = std::chrono::steady_clock::now();
+   generate_blocks( 20 );
+   const auto elapsed = std::chrono::steady_clock::now() - start;
+
+   stop = true;
+   for( auto& t : readers )
+      t.join();
+
+   BOOST_CHECK_EQUAL( db.head_block_num(), start_block_num + 20 );
+   // Each block waits at most for the readers which hold the lock when it starts, i.e. a few milliseconds
+   BOOST_CHECK_LT( std::chrono::duration_cast<std::chrono::milliseconds>( elapsed ).count(), 5000 );
+
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_CASE(verify_account_authority)
 {
       try {
@@ -1839,6 +2056,91 @@ BOOST_AUTO_TEST_CASE( get_settle_orders_by_account ) {
    }
 }
 
+BOOST_AUTO_TEST_CASE( get_price_feeds ) {
+   try {
+      ACTORS((creator)(feeder1)(feeder2)(feeder3));
+
+      graphene::app::database_api db_api(db, &(this->app.get_options()));
+
+      const auto &usd = create_bitasset("USD", creator_id);
+      const auto &core = asset_id_type()(db);
+      asset_id_type usd_id = usd.get_id();
+
+      update_feed_producers(usd, {feeder1_id, feeder2_id, feeder3_id});
+
+      // Producers get an empty feed each
+      auto feeds = db_api.get_price_feeds("USD");
+      BOOST_REQUIRE_EQUAL(feeds.size(), 3u);
+      BOOST_CHECK(feeds[0].publisher == feeder1_id);
+      BOOST_CHECK(feeds[1].publisher == feeder2_id);
+      BOOST_CHECK(feeds[2].publisher == feeder3_id);
+      for( const auto& f : feeds )
+      {
+         BOOST_CHECK(f.asset_id == usd_id);
+         BOOST_CHECK(f.feed.settlement_price.is_null());
+      }
+
+      price_feed current_feed;
+      current_feed.settlement_price = usd.amount(1) / core.amount(5);
+      publish_feed(usd, feeder2, current_feed);
+
+      feeds = db_api.get_price_feeds(std::string(object_id_type(usd_id)));
+      BOOST_REQUIRE_EQUAL(feeds.size(), 3u);
+      BOOST_CHECK(feeds[1].publication_time == db.head_block_time());
+      BOOST_CHECK(feeds[1].feed.settlement_price == current_feed.settlement_price);
+      BOOST_CHECK(feeds[0].feed.settlement_price.is_null());
+
+      // Removing a producer removes its feed, kept producers keep theirs
+      update_feed_producers(usd, {feeder2_id, feeder3_id});
+      feeds = db_api.get_price_feeds("USD");
+      BOOST_REQUIRE_EQUAL(feeds.size(), 2u);
+      BOOST_CHECK(feeds[0].publisher == feeder2_id);
+      BOOST_CHECK(feeds[0].feed.settlement_price == current_feed.settlement_price);
+      BOOST_CHECK(feeds[1].publisher == feeder3_id);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(usd.bitasset_data(db)).size(), 2u);
+
+      // The bitasset data object returned by get_objects still contains the feeds
+      auto objs = db_api.get_objects({ object_id_type(*usd.bitasset_data_id) });
+      BOOST_REQUIRE_EQUAL(objs.size(), 1u);
+      auto bitasset = objs[0].as<graphene::app::extended_asset_bitasset_data_object>(GRAPHENE_MAX_NESTED_OBJECTS);
+      BOOST_CHECK(bitasset.asset_id == usd_id);
+      BOOST_REQUIRE_EQUAL(bitasset.feeds.size(), 2u);
+      BOOST_CHECK(bitasset.feeds.begin()->first == feeder2_id);
+      BOOST_CHECK(bitasset.feeds.begin()->second.second.settlement_price == current_feed.settlement_price);
+
+      // Notifications of the subscribed bitasset data object contain the feeds too
+      const string bitasset_id_str = std::string(object_id_type(*usd.bitasset_data_id));
+      vector<graphene::app::extended_asset_bitasset_data_object> notified;
+      db_api.set_subscribe_callback( [&]( const variant& v ) {
+         for( const auto& item : v.get_array() )
+         {
+            if( item.is_object() && item.get_object().contains("id")
+                  && item.get_object()["id"].as_string() == bitasset_id_str )
+               notified.push_back( item.as<graphene::app::extended_asset_bitasset_data_object>(
+                                         GRAPHENE_MAX_NESTED_OBJECTS ) );
+         }
+      }, false );
+      db_api.get_objects({ object_id_type(*usd.bitasset_data_id) }, true);
+
+      current_feed.settlement_price = usd.amount(1) / core.amount(4);
+      publish_feed(usd, feeder3, current_feed);
+      generate_block();
+      fc::usleep(fc::milliseconds(200)); // sleep a while to execute callback in another thread
+
+      BOOST_REQUIRE_EQUAL(notified.size(), 1u);
+      BOOST_REQUIRE_EQUAL(notified[0].feeds.size(), 2u);
+      BOOST_CHECK(notified[0].feeds.rbegin()->first == feeder3_id);
+      BOOST_CHECK(notified[0].feeds.rbegin()->second.second.settlement_price == current_feed.settlement_price);
+
+      GRAPHENE_CHECK_THROW( db_api.get_price_feeds(GRAPHENE_SYMBOL), fc::exception );
+      GRAPHENE_CHECK_THROW( db_api.get_price_feeds("NOSUCHASSET"), fc::exception );
+
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
 BOOST_AUTO_TEST_CASE( asset_in_collateral )
 { try {
    ACTORS( (dan)(nathan) );
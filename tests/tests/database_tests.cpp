@@ -224,6 +224,113 @@ BOOST_AUTO_TEST_CASE( direct_index_test )
    // but the secondary has not updated its representation
 } FC_LOG_AND_RETHROW() }
 
+namespace {
+   /// Counts notifications about modifications of objects
+   class modify_counting_index : public graphene::db::secondary_index
+   {
+      public:
+         explicit modify_counting_index( graphene::db::modified_fields_type watched ) : _watched( watched ) {}
+
+         void about_to_modify( const object& before ) override { ++about_to_modify_count; }
+         void object_modified( const object& after  ) override { ++modified_count; }
+         graphene::db::modified_fields_type watched_fields()const override { return _watched; }
+
+         uint32_t about_to_modify_count = 0;
+         uint32_t modified_count = 0;
+
+      private:
+         graphene::db::modified_fields_type _watched;
+   };
+}
+
+namespace {
+   struct counting_index : graphene::db::secondary_index
+   {
+      void object_inserted( const object& obj ) override { ++inserted; }
+      size_t inserted = 0;
+   };
+   struct derived_counting_index : counting_index {};
+   struct unused_index : graphene::db::secondary_index {};
+}
+
+BOOST_AUTO_TEST_CASE( secondary_index_lookup_test )
+{ try {
+   graphene::db::primary_index< account_index > my_accounts( db );
+   GRAPHENE_REQUIRE_THROW( my_accounts.get_secondary_index< counting_index >(), fc::assert_exception );
+
+   const auto* derived = my_accounts.add_secondary_index< derived_counting_index >();
+   const auto* counting = my_accounts.add_secondary_index< counting_index >();
+   const auto* second_counting = my_accounts.add_secondary_index< counting_index >();
+
+   // exact types are found directly, the first index of a type wins
+   BOOST_CHECK( &my_accounts.get_secondary_index< derived_counting_index >() == derived );
+   BOOST_CHECK( &my_accounts.get_secondary_index< counting_index >() == counting );
+   BOOST_CHECK( counting != second_counting );
+   GRAPHENE_REQUIRE_THROW( my_accounts.get_secondary_index< unused_index >(), fc::assert_exception );
+
+   // a derived type is found through its base if the base type itself was not added
+   graphene::db::primary_index< account_index > other_accounts( db );
+   const auto* other_derived = other_accounts.add_secondary_index< derived_counting_index >();
+   BOOST_CHECK( &other_accounts.get_secondary_index< counting_index >() == other_derived );
+
+   account_object test_account;
+   test_account.id = object_id_type( account_id_type(1) );
+   my_accounts.load( fc::raw::pack( test_account ) );
+   BOOST_CHECK_EQUAL( 1u, derived->inserted );
+   BOOST_CHECK_EQUAL( 1u, counting->inserted );
+   BOOST_CHECK_EQUAL( 1u, second_counting->inserted );
+   BOOST_CHECK_EQUAL( 0u, other_derived->inserted );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( field_aware_modify_test )
+{ try {
+   graphene::db::primary_index< account_index, 8 > my_accounts( db );
+   const auto& auth_watcher = *my_accounts.add_secondary_index< modify_counting_index >(
+                                                                        account_object::authority_fields );
+   const auto& all_watcher = *my_accounts.add_secondary_index< modify_counting_index >( graphene::db::all_fields );
+   const auto& by_name_idx = my_accounts.indices().get<by_name>();
+
+   const auto& acct = static_cast< const account_object& >( my_accounts.create( [] ( object& o ) {
+      static_cast< account_object& >( o ).name = "account0";
+   } ) );
+
+   // only non-watched and non-key members are changed
+   my_accounts.modify( acct, [] ( object& o ) {
+      static_cast< account_object& >( o ).referrer = account_id_type(1);
+   }, account_object::other_fields );
+   BOOST_CHECK( acct.referrer == account_id_type(1) );
+   BOOST_CHECK_EQUAL( 0u, auth_watcher.about_to_modify_count );
+   BOOST_CHECK_EQUAL( 0u, auth_watcher.modified_count );
+   BOOST_CHECK_EQUAL( 1u, all_watcher.about_to_modify_count );
+   BOOST_CHECK_EQUAL( 1u, all_watcher.modified_count );
+   BOOST_CHECK( by_name_idx.find( "account0" ) != by_name_idx.end() );
+
+   // watched members are changed
+   my_accounts.modify( acct, [] ( object& o ) {
+      static_cast< account_object& >( o ).active.weight_threshold = 2;
+   }, account_object::authority_fields );
+   BOOST_CHECK_EQUAL( 2u, acct.active.weight_threshold );
+   BOOST_CHECK_EQUAL( 1u, auth_watcher.about_to_modify_count );
+   BOOST_CHECK_EQUAL( 1u, auth_watcher.modified_count );
+   BOOST_CHECK_EQUAL( 2u, all_watcher.modified_count );
+
+   // without declared fields, all secondary indexes are notified
+   my_accounts.modify( acct, [] ( object& o ) {
+      static_cast< account_object& >( o ).referrer = account_id_type(2);
+   } );
+   BOOST_CHECK_EQUAL( 2u, auth_watcher.modified_count );
+   BOOST_CHECK_EQUAL( 3u, all_watcher.modified_count );
+
+   // a changed key is re-indexed
+   my_accounts.modify( acct, [] ( object& o ) {
+      static_cast< account_object& >( o ).name = "account1";
+   }, account_object::name_field );
+   BOOST_CHECK( by_name_idx.find( "account0" ) == by_name_idx.end() );
+   BOOST_CHECK( by_name_idx.find( "account1" ) != by_name_idx.end() );
+   BOOST_CHECK_EQUAL( 2u, auth_watcher.modified_count );
+   BOOST_CHECK_EQUAL( 4u, all_watcher.modified_count );
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_CASE( required_approval_index_test ) // see https://github.com/bitshares/bitshares-core/issues/1719
 { try {
    ACTORS( (alice)(bob)(charlie)(agnetha)(benny)(carlos) );
@@ -311,4 +418,205 @@ BOOST_AUTO_TEST_CASE( required_approval_index_test ) // see https://github.com/b
 
 } FC_LOG_AND_RETHROW() }
 
+BOOST_AUTO_TEST_CASE( account_membership_map_test )
+{ try {
+   account_membership_map< account_id_type, account_id_membership_hash > members;
+   BOOST_CHECK( members.find( account_id_type(1) ) == nullptr );
+   members.erase( account_id_type(1), account_id_type(2) );
+   BOOST_CHECK_EQUAL( 0u, members.size() );
+
+   // enough keys to rehash several times
+   const uint64_t keys = 1000;
+   for( uint64_t i = 0; i < keys; ++i )
+   {
+      members.insert( account_id_type(i), account_id_type(i + 2) );
+      members.insert( account_id_type(i), account_id_type(i + 1) );
+      members.insert( account_id_type(i), account_id_type(i + 1) );
+   }
+   BOOST_CHECK_EQUAL( keys, members.size() );
+   for( uint64_t i = 0; i < keys; ++i )
+   {
+      const auto* accounts = members.find( account_id_type(i) );
+      BOOST_REQUIRE( accounts != nullptr );
+      BOOST_REQUIRE_EQUAL( 2u, accounts->size() );
+      BOOST_CHECK( (*accounts)[0] == account_id_type(i + 1) );
+      BOOST_CHECK( (*accounts)[1] == account_id_type(i + 2) );
+   }
+
+   // removing keys must not hide the keys which were probed past them
+   for( uint64_t i = 1; i < keys; i += 2 )
+   {
+      members.erase( account_id_type(i), account_id_type(i + 1) );
+      BOOST_CHECK( members.find( account_id_type(i) ) != nullptr );
+      members.erase( account_id_type(i), account_id_type(i + 2) );
+      BOOST_CHECK( members.find( account_id_type(i) ) == nullptr );
+   }
+   BOOST_CHECK_EQUAL( keys / 2, members.size() );
+   for( uint64_t i = 0; i < keys; i += 2 )
+      BOOST_CHECK( members.find( account_id_type(i) ) != nullptr );
+
+   size_t visited = 0;
+   members.for_each( [&visited]( const account_id_type& key, const auto& accounts ) {
+      BOOST_CHECK_EQUAL( 0u, key.instance.value % 2 );
+      BOOST_CHECK_EQUAL( 2u, accounts.size() );
+      ++visited;
+   });
+   BOOST_CHECK_EQUAL( keys / 2, visited );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( recent_transaction_cache_test )
+{ try {
+   ACTORS( (alice)(bob) );
+   fund( alice, asset(100000) );
+
+   transfer_operation op;
+   op.from = alice_id;
+   op.to = bob_id;
+   op.amount = asset(100);
+   signed_transaction tx;
+   tx.operations.push_back( op );
+   set_expiration( db, tx );
+   tx.sign( alice_private_key, db.get_chain_id() );
+   PUSH_TX( db, tx );
+   const transaction_id_type tx_id = tx.id();
+
+   BOOST_CHECK( db.is_known_transaction( tx_id ) );
+   BOOST_CHECK( db.get_recent_transaction( tx_id ).id() == tx_id );
+   GRAPHENE_REQUIRE_THROW( PUSH_TX( db, tx ), duplicate_transaction );
+
+   // the de-duplication index only keeps the ID
+   const auto& dedupe_index = db.get_index_type<transaction_index>().indices().get<by_trx_id>();
+   BOOST_REQUIRE( dedupe_index.find( tx_id ) != dedupe_index.end() );
+   BOOST_CHECK( dedupe_index.find( tx_id )->expiration == tx.expiration );
+
+   generate_block();
+   BOOST_CHECK( db.get_recent_transaction( tx_id ).id() == tx_id );
+
+   // the body is dropped with the ID after expiration
+   generate_blocks( tx.expiration + db.get_global_properties().parameters.block_interval );
+   BOOST_CHECK( !db.is_known_transaction( tx_id ) );
+   GRAPHENE_REQUIRE_THROW( db.get_recent_transaction( tx_id ), fc::exception );
+
+   // a bounded cache drops the oldest transactions first
+   recent_transaction_cache cache;
+   cache.set_capacity( 2 );
+   vector<signed_transaction> txs( 3 );
+   for( size_t i = 0; i < txs.size(); ++i )
+   {
+      txs[i].expiration = db.head_block_time() + fc::seconds( 10 * ( txs.size() - i ) );
+      cache.add( txs[i].id(), txs[i] );
+   }
+   BOOST_CHECK_EQUAL( cache.size(), 2u );
+   BOOST_CHECK( !cache.find( txs[0].id() ).valid() );
+   BOOST_CHECK( cache.find( txs[1].id() ).valid() );
+   BOOST_CHECK( cache.find( txs[2].id() ).valid() );
+
+   // txs[2] expires before txs[1]
+   cache.remove_expired( db.head_block_time() + fc::seconds(15) );
+   BOOST_CHECK_EQUAL( cache.size(), 1u );
+   BOOST_CHECK( cache.find( txs[1].id() ).valid() );
+
+   cache.set_capacity( 0 );
+   BOOST_CHECK_EQUAL( cache.size(), 0u );
+   cache.add( txs[0].id(), txs[0] );
+   BOOST_CHECK_EQUAL( cache.size(), 0u );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( balances_by_account_index_test )
+{ try {
+   ACTORS( (alice) );
+
+   // issue the assets in reverse order of their IDs
+   vector<asset_id_type> assets;
+   for( const string& symbol : { "AAA", "BBB", "CCC", "DDD", "EEE" } )
+      assets.push_back( create_user_issued_asset( symbol ).get_id() );
+   for( auto itr = assets.rbegin(); itr != assets.rend(); ++itr )
+      issue_uia( alice_id, asset( 100 + itr->instance.value, *itr ) );
+   generate_block();
+
+   const auto& index = db.get_index_type< primary_index< account_balance_index > >()
+                         .get_secondary_index< balances_by_account_index >();
+   const auto& balances = index.get_account_balances( alice_id );
+   BOOST_REQUIRE_EQUAL( balances.size(), assets.size() );
+   size_t i = 0;
+   for( const auto& entry : balances )
+   {
+      BOOST_CHECK( entry.first == assets[i] );
+      BOOST_CHECK( entry.second->owner == alice_id );
+      BOOST_CHECK_EQUAL( entry.second->balance.value, 100 + assets[i].instance.value );
+      BOOST_CHECK( db.get_balance( alice_id, assets[i] ) == asset( 100 + assets[i].instance.value, assets[i] ) );
+      ++i;
+   }
+   BOOST_CHECK( index.get_account_balance( alice_id, asset_id_type() ) == nullptr );
+   BOOST_CHECK( index.get_account_balances( account_id_type(1000000) ).empty() );
+
+   // balance objects created in an undone block are removed from the index
+   issue_uia( alice_id, asset( 1, assets[0] ) );
+   fund( alice_id(db), asset( 1000 ) );
+   generate_block();
+   BOOST_CHECK_EQUAL( index.get_account_balances( alice_id ).size(), assets.size() + 1 );
+   db.pop_block();
+   BOOST_CHECK_EQUAL( index.get_account_balances( alice_id ).size(), assets.size() );
+   BOOST_CHECK( index.get_account_balance( alice_id, asset_id_type() ) == nullptr );
+   BOOST_CHECK( db.get_balance( alice_id, assets[0] ) == asset( 100 + assets[0].instance.value, assets[0] ) );
+} FC_LOG_AND_RETHROW() }
+
+namespace {
+   struct test_pool_tag {};
+   struct test_node { char data[100]; };
+}
+
+BOOST_AUTO_TEST_CASE( object_pool_test )
+{ try {
+   auto& pool = graphene::db::object_pool::instance< test_pool_tag, test_node >( "test" );
+
+   auto stats = pool.get_statistics();
+   BOOST_CHECK_GE( stats.node_size, sizeof(test_node) );
+   BOOST_CHECK_EQUAL( 0u, stats.node_size % alignof(std::max_align_t) );
+   BOOST_CHECK_EQUAL( 0u, stats.nodes_in_use );
+
+   // allocate more than one slab
+   const size_t count = 1000;
+   std::set<void*> nodes;
+   for( size_t i = 0; i < count; ++i )
+      nodes.insert( pool.allocate() );
+   BOOST_CHECK_EQUAL( count, nodes.size() );
+   stats = pool.get_statistics();
+   BOOST_CHECK_EQUAL( count, stats.nodes_in_use );
+   BOOST_CHECK_GE( stats.bytes_reserved, count * stats.node_size );
+   BOOST_CHECK_EQUAL( stats.bytes_reserved, ( stats.nodes_in_use + stats.nodes_free ) * stats.node_size );
+   const uint64_t reserved = stats.bytes_reserved;
+
+   // freed nodes are reused without reserving more memory
+   for( void* node : nodes )
+      pool.deallocate( node );
+   BOOST_CHECK_EQUAL( 0u, pool.get_statistics().nodes_in_use );
+   for( size_t i = 0; i < count; ++i )
+      BOOST_CHECK( nodes.find( pool.allocate() ) != nodes.end() );
+   BOOST_CHECK_EQUAL( reserved, pool.get_statistics().bytes_reserved );
+   for( void* node : nodes )
+      pool.deallocate( node );
+
+   // limit orders and their undo copies are taken from pools
+   ACTORS( (alice) );
+   fund( alice, asset( 1000000 ) );
+   const auto& usd = create_user_issued_asset( "USD" );
+   generate_block();
+   create_sell_order( alice_id, asset( 1000 ), usd.amount( 1000 ) );
+   generate_block();
+
+   auto find_pool = []( const string& name ) {
+      for( const auto& item : graphene::db::object_pool::get_all_statistics() )
+      {
+         if( item.name == name )
+            return item;
+      }
+      BOOST_FAIL( "Pool " + name + " not found" );
+      return graphene::db::object_pool_statistics();
+   };
+   BOOST_CHECK_GT( find_pool( "graphene::chain::limit_order_object index nodes" ).nodes_in_use, 0u );
+   BOOST_CHECK_GT( find_pool( "graphene::chain::account_statistics_object copies" ).bytes_reserved, 0u );
+   BOOST_CHECK_EQUAL( find_pool( pool.get_statistics().name ).nodes_in_use, 0u );
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -58,4 +58,55 @@ BOOST_AUTO_TEST_CASE(api_limit_get_grouped_limit_orders) {
     throw;
    }
 }
+BOOST_AUTO_TEST_CASE(get_grouped_limit_orders_snapshot) {
+   try
+   {
+   app.enable_plugin("grouped_orders");
+   graphene::app::orders_api orders_api(app);
+   optional<price> start;
+
+   ACTORS( (dan) );
+   asset_id_type usd_id = create_user_issued_asset("USD").get_id();
+   issue_uia( dan_id, asset(1000, usd_id) );
+   generate_block();
+
+   auto core = std::string( asset_id_type() );
+   auto usd = std::string( usd_id );
+
+   create_sell_order( dan_id, asset(100, usd_id), asset(100) );
+   create_sell_order( dan_id, asset(200, usd_id), asset(201) );
+
+   // the snapshot is not updated until the next block
+   auto groups = orders_api.get_grouped_limit_orders( usd, core, 10, start, 10 );
+   BOOST_CHECK_EQUAL( groups.size(), 0u );
+
+   generate_block();
+
+   groups = orders_api.get_grouped_limit_orders( usd, core, 10, start, 10 );
+   BOOST_REQUIRE_EQUAL( groups.size(), 2u );
+   BOOST_CHECK( groups[0].min_price == asset(100, usd_id) / asset(100) );
+   BOOST_CHECK_EQUAL( groups[0].total_for_sale.value, 100 );
+   BOOST_CHECK( groups[1].min_price == asset(200, usd_id) / asset(201) );
+   BOOST_CHECK_EQUAL( groups[1].total_for_sale.value, 200 );
+
+   // both orders are in the same 1% group
+   groups = orders_api.get_grouped_limit_orders( usd, core, 100, start, 10 );
+   BOOST_REQUIRE_EQUAL( groups.size(), 1u );
+   BOOST_CHECK_EQUAL( groups[0].total_for_sale.value, 300 );
+
+   start = asset(1000, usd_id) / asset(1003);
+   groups = orders_api.get_grouped_limit_orders( usd, core, 10, start, 10 );
+   BOOST_REQUIRE_EQUAL( groups.size(), 1u );
+   BOOST_CHECK( groups[0].min_price == asset(200, usd_id) / asset(201) );
+
+   // the other side of the market is empty
+   start.reset();
+   groups = orders_api.get_grouped_limit_orders( core, usd, 10, start, 10 );
+   BOOST_CHECK_EQUAL( groups.size(), 0u );
+   }catch (fc::exception &e)
+   {
+    edump((e.to_detail_string()));
+    throw;
+   }
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -28,6 +28,8 @@
 
 #include <graphene/chain/hardfork.hpp>
 
+#include <graphene/market_history/market_history_plugin.hpp>
+
 #include <graphene/utilities/tempdir.hpp>
 
 #include <fc/crypto/digest.hpp>
@@ -1155,4 +1157,127 @@ BOOST_AUTO_TEST_CASE(api_limit_get_account_history_by_operations) {
  }
 }
 
+BOOST_AUTO_TEST_CASE(market_history_bucket_recycling) {
+ try {
+   using namespace graphene::market_history;
+
+   // history-per-size is set to 3 for this test, so at most 4 buckets are kept per market and bucket size
+   asset_id_type usd_id = create_user_issued_asset("USD").get_id();
+
+   ACTORS( (dan)(bob) );
+   fund( dan, asset(1000) );
+   issue_uia( bob_id, asset(1000, usd_id) );
+
+   const auto& by_key_idx = db.get_index_type<bucket_index>().indices().get<by_key>();
+   auto get_buckets = [&]() {
+      vector<bucket_object> result;
+      auto itr = by_key_idx.lower_bound( bucket_key( asset_id_type(), usd_id, 15, fc::time_point_sec() ) );
+      while( itr != by_key_idx.end() && itr->key.base == asset_id_type() && itr->key.quote == usd_id
+                && itr->key.seconds == 15 )
+      {
+         result.push_back( *itr );
+         ++itr;
+      }
+      return result;
+   };
+
+   optional<bucket_object> first_bucket;
+   for( int i = 0; i < 8; ++i )
+   {
+      create_sell_order( dan_id, asset(100), asset(100, usd_id) );
+      create_sell_order( bob_id, asset(100, usd_id), asset(100) );
+      generate_block();
+
+      auto buckets = get_buckets();
+      BOOST_REQUIRE( !buckets.empty() );
+      BOOST_CHECK_LE( buckets.size(), 4u );
+      if( !first_bucket.valid() )
+         first_bucket = buckets.front();
+
+      generate_blocks( db.head_block_time() + 15 );
+   }
+
+   // The first bucket has expired and its object has been reused for a newer bucket
+   const auto& by_id_idx = db.get_index_type<bucket_index>().indices().get<by_id>();
+   auto itr = by_id_idx.find( first_bucket->id );
+   BOOST_REQUIRE( itr != by_id_idx.end() );
+   BOOST_CHECK( itr->key.open > first_bucket->key.open );
+   BOOST_CHECK_EQUAL( itr->base_volume.value, 100 );
+   BOOST_CHECK_EQUAL( itr->quote_volume.value, 100 );
+
+ } catch (fc::exception &e) {
+   edump((e.to_detail_string()));
+   throw;
+ }
+}
+
+BOOST_AUTO_TEST_CASE(market_trade_log_consistency) {
+ try {
+   using namespace graphene::market_history;
+
+   // at most 2 records are kept per market in this test
+   asset_id_type usd_id = create_user_issued_asset("USD").get_id();
+
+   ACTORS( (dan)(bob) );
+   fund( dan, asset(1000) );
+   issue_uia( bob_id, asset(1000, usd_id) );
+
+   const auto& history_idx = db.get_index_type<history_index>().indices().get<by_key>();
+   const auto& trade_logs = db.get_index_type< primary_index<history_index> >()
+                              .get_secondary_index<market_trade_log_index>();
+
+   // The log must contain the same records as the index, in the same order
+   auto check_log = [&]( size_t expected_size ) {
+      const auto* log = trade_logs.get_market_log( asset_id_type(), usd_id );
+      vector<const order_history_object*> records;
+      history_key hkey;
+      hkey.base = asset_id_type();
+      hkey.quote = usd_id;
+      hkey.sequence = std::numeric_limits<int64_t>::min();
+      for( auto itr = history_idx.lower_bound( hkey );
+           itr != history_idx.end() && itr->key.base == hkey.base && itr->key.quote == hkey.quote; ++itr )
+         records.push_back( &(*itr) );
+      BOOST_REQUIRE_EQUAL( records.size(), expected_size );
+      if( expected_size == 0 )
+      {
+         BOOST_CHECK( log == nullptr );
+         return;
+      }
+      BOOST_REQUIRE( log != nullptr );
+      BOOST_REQUIRE_EQUAL( log->size(), expected_size );
+      BOOST_CHECK( std::equal( records.begin(), records.end(), log->begin() ) );
+   };
+
+   check_log( 0 );
+
+   create_sell_order( dan_id, asset(100), asset(100, usd_id) );
+   create_sell_order( bob_id, asset(100, usd_id), asset(100) );
+   generate_block();
+   check_log( 2 );
+   int64_t oldest_sequence = trade_logs.get_market_log( asset_id_type(), usd_id )->back()->key.sequence;
+
+   create_sell_order( dan_id, asset(100), asset(100, usd_id) );
+   create_sell_order( bob_id, asset(100, usd_id), asset(100) );
+   generate_block();
+   // the first trade has been pruned
+   check_log( 2 );
+   const auto* log = trade_logs.get_market_log( asset_id_type(), usd_id );
+   BOOST_CHECK_LT( log->back()->key.sequence, oldest_sequence );
+   BOOST_CHECK( market_trade_log_index::lower_bound_by_sequence( *log, log->front()->key.sequence )
+                == log->begin() );
+   BOOST_CHECK( market_trade_log_index::lower_bound_by_time( *log, db.head_block_time() ) == log->begin() );
+   BOOST_CHECK( market_trade_log_index::lower_bound_by_time( *log, db.head_block_time() - 1 ) == log->end() );
+
+   // undoing the block restores the pruned records
+   db.pop_block();
+   check_log( 2 );
+   log = trade_logs.get_market_log( asset_id_type(), usd_id );
+   BOOST_CHECK_EQUAL( log->back()->key.sequence, oldest_sequence );
+
+ } catch (fc::exception &e) {
+   edump((e.to_detail_string()));
+   throw;
+ }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
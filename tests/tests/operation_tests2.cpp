@@ -741,7 +741,7 @@ BOOST_AUTO_TEST_CASE( mia_feeds )
    }
    {
       const asset_bitasset_data_object& obj = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(obj.feeds.size(), 3u);
+      BOOST_CHECK_EQUAL(db.get_bitasset_feeds(obj).size(), 3u);
       BOOST_CHECK( obj.current_feed.margin_call_params_equal( price_feed() ) );
    }
    {
@@ -2293,4 +2293,65 @@ BOOST_AUTO_TEST_CASE( buyback )
    } FC_LOG_AND_RETHROW()
 }
 
+/// The first purchase of a buyback account inserts a balance object while its balances are processed
+BOOST_AUTO_TEST_CASE( buyback_first_purchase_in_maintenance )
+{ try {
+   ACTORS( (alice)(izzy)(philbin) );
+   upgrade_to_lifetime_member(philbin_id);
+
+   generate_blocks( HARDFORK_555_TIME );
+   set_expiration( db, trx );
+
+   asset_id_type buyme_id = create_user_issued_asset( "BUYME", izzy_id(db), 0 ).get_id();
+   asset_id_type sellme_id = create_user_issued_asset( "SELLME", izzy_id(db), 0 ).get_id();
+
+   account_id_type rex_id;
+   {
+      buyback_account_options bbo;
+      bbo.asset_to_buy = buyme_id;
+      bbo.asset_to_buy_issuer = izzy_id;
+      bbo.markets.emplace( asset_id_type() );
+      bbo.markets.emplace( sellme_id );
+      account_create_operation create_op = make_account( "rex" );
+      create_op.registrar = philbin_id;
+      create_op.extensions.value.buyback_options = bbo;
+      create_op.owner = authority::null_authority();
+      create_op.active = authority::null_authority();
+
+      signed_transaction tx;
+      tx.operations.push_back( create_op );
+      set_expiration( db, tx );
+      sign( tx, izzy_private_key );
+      sign( tx, philbin_private_key );
+      processed_transaction ptx = PUSH_TX( db, tx );
+      rex_id = ptx.operation_results.back().get< object_id_type >();
+   }
+
+   set_expiration( db, trx );
+   issue_uia( alice_id, asset( 1000, buyme_id ) );
+   // Alice sells BUYME for CORE and for SELLME at 10 per BUYME
+   limit_order_id_type core_order_id =
+         create_sell_order( alice_id, asset( 100, buyme_id ), asset( 1000, asset_id_type() ) )->get_id();
+   limit_order_id_type sellme_order_id =
+         create_sell_order( alice_id, asset( 100, buyme_id ), asset( 1000, sellme_id ) )->get_id();
+
+   // Rex holds CORE and SELLME, but no BUYME yet
+   fund( rex_id(db), asset( 100 ) );
+   issue_uia( rex_id, asset( 100, sellme_id ) );
+   const auto& bal_idx = db.get_index_type< primary_index< account_balance_index > >()
+                           .get_secondary_index< balances_by_account_index >();
+   BOOST_CHECK( bal_idx.get_account_balance( rex_id, buyme_id ) == nullptr );
+
+   generate_blocks( db.get_dynamic_global_properties().next_maintenance_time );
+   generate_block();
+
+   // Both holdings were sold exactly once
+   BOOST_CHECK_EQUAL( core_order_id(db).for_sale.value, 90 );
+   BOOST_CHECK_EQUAL( sellme_order_id(db).for_sale.value, 90 );
+   BOOST_CHECK_EQUAL( get_balance( rex_id, asset_id_type() ), 0 );
+   BOOST_CHECK_EQUAL( get_balance( rex_id, sellme_id ), 0 );
+   BOOST_CHECK( bal_idx.get_account_balance( rex_id, buyme_id ) != nullptr );
+
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -197,16 +197,18 @@ BOOST_AUTO_TEST_CASE(bsip36)
       publish_feed(bit_usd_id(db), witness0_id(db), feed);
 
       asset_bitasset_data_object bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 1u);
-      auto itr = bitasset_data.feeds.begin();
+      auto feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 1u);
+      auto itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 16u);
 
       feed.settlement_price = bit_usd_id(db).amount(2) / core.amount(5);
       publish_feed(bit_usd_id(db), witness1_id(db), feed);
 
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      itr = bitasset_data.feeds.begin();
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      itr = feeds.begin();
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 16u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 17u);
 
@@ -248,16 +250,18 @@ BOOST_AUTO_TEST_CASE(bsip36)
       // witness0 has been removed but it was a feeder before
       // Feed persist in the blockchain, this reproduces the issue
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      itr = bitasset_data.feeds.begin();
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      itr = feeds.begin();
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 16u);
 
       // Feed persist after expiration
       const auto feed_lifetime = bit_usd_id(db).bitasset_data(db).options.feed_lifetime_sec;
       generate_blocks(db.head_block_time() + feed_lifetime + 1);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      itr = bitasset_data.feeds.begin();
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      itr = feeds.begin();
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 16u);
 
       // Other witnesses add more feeds
@@ -268,8 +272,9 @@ BOOST_AUTO_TEST_CASE(bsip36)
 
       // But the one from witness0 is never removed
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      itr = bitasset_data.feeds.begin();
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 4u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      itr = feeds.begin();
+      BOOST_CHECK_EQUAL(feeds.size(), 4u);
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 16u);
 
       // Feed from witness1 is also expired but never deleted
@@ -286,14 +291,16 @@ BOOST_AUTO_TEST_CASE(bsip36)
 
       //  All expired feeds are deleted
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 0u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 0u);
 
       // witness1 start feed producing again
       feed.settlement_price = bit_usd_id(db).amount(1) / core.amount(5);
       publish_feed(bit_usd_id(db), witness1_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 1u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 1u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 17u);
 
       // generate some blocks up to expiration but feed will not be deleted yet as need next maint time
@@ -303,8 +310,9 @@ BOOST_AUTO_TEST_CASE(bsip36)
       feed.settlement_price = bit_usd_id(db).amount(1) / core.amount(5);
       publish_feed(bit_usd_id(db), witness2_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 17u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 18u);
 
@@ -314,22 +322,25 @@ BOOST_AUTO_TEST_CASE(bsip36)
 
       // feed from witness0 expires and gets deleted, feed from witness is on time so persist
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 1u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 1u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 18u);
 
       // expire everything
       generate_blocks(itr[0].second.first + feed_lifetime + 1);
       generate_blocks(db.get_dynamic_global_properties().next_maintenance_time);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 0u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 0u);
 
       // add new feed with witness1
       feed.settlement_price = bit_usd_id(db).amount(1) / core.amount(5);
       publish_feed(bit_usd_id(db), witness1_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 1u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 1u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 17u);
 
       // Reactivate witness0
@@ -368,8 +379,9 @@ BOOST_AUTO_TEST_CASE(bsip36)
       BOOST_CHECK_EQUAL(witnesses.begin()[10].instance.value, 22u);
 
       // feed from witness1 is still here as the witness is no longer a producer but the feed is not yet expired
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 1u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 1u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 17u);
 
       // make feed from witness1 expire
@@ -377,7 +389,8 @@ BOOST_AUTO_TEST_CASE(bsip36)
       generate_blocks(db.get_dynamic_global_properties().next_maintenance_time);
 
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 0u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 0u);
 
    } FC_LOG_AND_RETHROW()
 }
@@ -423,8 +436,9 @@ BOOST_AUTO_TEST_CASE(bsip36_update_feed_producers)
       // Bitshares will create entries in the field feed after feed producers are added
       auto bitasset_data = bit_usd_id(db).bitasset_data(db);
 
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 3u);
-      auto itr = bitasset_data.feeds.begin();
+      auto feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 3u);
+      auto itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 16u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 17u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 18u);
@@ -444,8 +458,9 @@ BOOST_AUTO_TEST_CASE(bsip36_update_feed_producers)
 
       // Feed for removed producer is removed
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 17u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 18u);
 
@@ -453,8 +468,9 @@ BOOST_AUTO_TEST_CASE(bsip36_update_feed_producers)
       const auto feed_lifetime = bit_usd_id(db).bitasset_data(db).options.feed_lifetime_sec;
       generate_blocks(db.head_block_time() + feed_lifetime + 1);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      itr = bitasset_data.feeds.begin();
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      itr = feeds.begin();
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 17u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 18u);
 
@@ -466,8 +482,9 @@ BOOST_AUTO_TEST_CASE(bsip36_update_feed_producers)
 
       // Expired feeds persist, no changes
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      itr = bitasset_data.feeds.begin();
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      itr = feeds.begin();
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 17u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 18u);
 
@@ -512,8 +529,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       feed.settlement_price = bit_usd_id(db).amount(1) / core_id(db).amount(5);
       publish_feed(bit_usd_id(db), witness5_id(db), feed);
       auto bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 1u);
-      auto itr = bitasset_data.feeds.begin();
+      auto feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 1u);
+      auto itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
 
       generate_blocks(db.get_dynamic_global_properties().next_maintenance_time);
@@ -522,8 +540,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       feed.settlement_price = bit_usd_id(db).amount(1) / core_id(db).amount(5);
       publish_feed(bit_usd_id(db), witness6_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 22u);
 
@@ -533,8 +552,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       feed.settlement_price = bit_usd_id(db).amount(1) / core_id(db).amount(5);
       publish_feed(bit_usd_id(db), witness7_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 3u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 3u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 22u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 23u);
@@ -545,8 +565,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       feed.settlement_price = bit_usd_id(db).amount(1) / core_id(db).amount(5);
       publish_feed(bit_usd_id(db), witness8_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 4u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 4u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 22u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 23u);
@@ -558,8 +579,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       feed.settlement_price = bit_usd_id(db).amount(1) / core_id(db).amount(5);
       publish_feed(bit_usd_id(db), witness9_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 5u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 5u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 22u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 23u);
@@ -572,8 +594,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       feed.settlement_price = bit_usd_id(db).amount(1) / core_id(db).amount(5);
       publish_feed(bit_usd_id(db), witness10_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 6u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 6u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 22u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 23u);
@@ -586,8 +609,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       generate_block();
 
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 5u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 5u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 22u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 23u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 24u);
@@ -601,8 +625,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       generate_block();
 
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 3u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 3u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 24u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 25u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 26u);
@@ -611,8 +636,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       feed.settlement_price = bit_usd_id(db).amount(1) / core_id(db).amount(5);
       publish_feed(bit_usd_id(db), witness5_id(db), feed);
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 4u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 4u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 24u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 25u);
@@ -622,8 +648,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       generate_blocks(db.get_dynamic_global_properties().next_maintenance_time);
       generate_block();
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 3u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 3u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
       BOOST_CHECK_EQUAL(itr[1].first.instance.value, 25u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 26u);
@@ -632,8 +659,9 @@ BOOST_AUTO_TEST_CASE(bsip36_additional)
       generate_blocks(db.get_dynamic_global_properties().next_maintenance_time);
       generate_block();
       bitasset_data = bit_usd_id(db).bitasset_data(db);
-      BOOST_CHECK_EQUAL(bitasset_data.feeds.size(), 2u);
-      itr = bitasset_data.feeds.begin();
+      feeds = db.get_bitasset_feeds(bitasset_data);
+      BOOST_CHECK_EQUAL(feeds.size(), 2u);
+      itr = feeds.begin();
       BOOST_CHECK_EQUAL(itr[0].first.instance.value, 21u);
       BOOST_CHECK_EQUAL(itr[2].first.instance.value, 26u);
 